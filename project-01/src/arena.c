@@ -0,0 +1,102 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Arena allocator shared by the schedulers
+
+ * Process and Gantt storage is carved out of large chunks and grows geometrically,
+ * so traces of any length avoid stack arrays and per-entry mallocs.
+ * Everything is released in a single arena_free call at the end of a run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+// Keep every allocation aligned for any element type
+#define ARENA_ALIGNMENT 16
+#define ALIGN_UP(n) (((n) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+/**
+ * Initialize an empty arena
+ */
+void arena_init(Arena *arena) {
+    arena->chunks = NULL;
+    arena->last_allocation = NULL;
+    arena->bytes_reserved = 0;
+}
+
+/**
+ * Allocate memory from the arena (exits if the system is out of memory)
+ */
+void *arena_alloc(Arena *arena, size_t size) {
+    size = ALIGN_UP(size);
+    ArenaChunk *chunk = arena->chunks;
+
+    // Start a new chunk if the current one is full
+    if (chunk == NULL || chunk->size - chunk->used < size) {
+        size_t chunk_size = (size > ARENA_CHUNK_SIZE) ? size : ARENA_CHUNK_SIZE;
+        chunk = (ArenaChunk *)malloc(sizeof(ArenaChunk) + chunk_size);
+        if (chunk == NULL) {
+            printf("Error: Out of memory allocating %zu bytes\n", size);
+            exit(1);
+        }
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+        arena->bytes_reserved += chunk_size;
+    }
+
+    void *memory = chunk->data + chunk->used;
+    chunk->used += size;
+    arena->last_allocation = memory;
+    return memory;
+}
+
+/**
+ * Resize an allocation, extending in place when it is the newest one in its chunk
+ */
+void *arena_resize(Arena *arena, void *old, size_t old_size, size_t new_size) {
+    ArenaChunk *chunk = arena->chunks;
+    old_size = ALIGN_UP(old_size);
+    new_size = ALIGN_UP(new_size);
+
+    if (old != NULL && old == arena->last_allocation &&
+        chunk->size - (chunk->used - old_size) >= new_size) {
+        chunk->used = chunk->used - old_size + new_size;
+        return old;
+    }
+
+    void *memory = arena_alloc(arena, new_size);
+    if (old != NULL) {
+        memcpy(memory, old, old_size < new_size ? old_size : new_size);
+    }
+    return memory;
+}
+
+/**
+ * Double the capacity of an arena-backed array
+ */
+void *arena_grow_array(Arena *arena, void *items, int *capacity, size_t element_size) {
+    int new_capacity = (*capacity < 16) ? 16 : *capacity * 2;
+    items = arena_resize(arena, items, (size_t)*capacity * element_size,
+                         (size_t)new_capacity * element_size);
+    *capacity = new_capacity;
+    return items;
+}
+
+/**
+ * Release every chunk owned by the arena
+ */
+void arena_free(Arena *arena) {
+    ArenaChunk *current = arena->chunks;
+    while (current != NULL) {
+        ArenaChunk *next = current->next;
+        free(current);
+        current = next;
+    }
+    arena_init(arena);
+}
@@ -0,0 +1,31 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// Default size of each arena chunk (larger requests get their own chunk)
+#define ARENA_CHUNK_SIZE (1 << 20)
+
+// One chunk of arena memory, chained so the whole arena is freed in one pass
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t size;
+    size_t used;
+    unsigned char data[];
+} ArenaChunk;
+
+// Bump allocator: memory is only released all at once by arena_free
+typedef struct {
+    ArenaChunk *chunks;
+    void *last_allocation;
+    size_t bytes_reserved;
+} Arena;
+
+// Arena functions
+void arena_init(Arena *arena);
+void *arena_alloc(Arena *arena, size_t size);
+void *arena_resize(Arena *arena, void *old, size_t old_size, size_t new_size);
+void *arena_grow_array(Arena *arena, void *items, int *capacity, size_t element_size);
+void arena_free(Arena *arena);
+
+#endif // ARENA_H
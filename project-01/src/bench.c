@@ -0,0 +1,792 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Scheduler benchmarks
+
+ * Process table layout: compares a full scan of the old array-of-structs Process
+ * layout against the structure-of-arrays ProcessTable. The scan is the ready-process
+ * selection loop every scheduler runs, so it only reads arrival, burst and completion
+ * state. Cache misses are read from the hardware counters when the kernel allows it.
+
+ * Scaling: runs every scheduler, and SJF/Round Robin with every allocation and paging
+ * combination, on synthetic workloads of each size. Each run happens in a forked child
+ * so its peak RSS can be read on its own, and the cost per event (one dispatch) is
+ * compared with the previous size so superlinear growth stands out.
+
+ * Allocators: replays the same allocate/free churn through the generic allocation
+ * loops, which walk the block list to allocate and to free and test the algorithm for
+ * every block and page, and through the specialized allocators and block handles, for
+ * every allocation and paging combination.
+
+ * Latency: fills memory with 10^4 to 10^6 live blocks, then frees a random block and
+ * allocates a new one many times, timing every operation on its own. The spread of
+ * those times shows how each algorithm's worst case depends on the number of blocks.
+
+ * Usage: ./bench [-k layout,schedulers,memory,allocators,latency] [-n sizes] [-a poisson|bursty]
+ *                [-b exponential|pareto|bimodal] [-l load] [-c cluster_size]
+ *                [-m mean_burst] [-r seed] [num_processes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <linux/perf_event.h>
+#include "sjf.h"
+#include "round_robin.h"
+#include "srtf.h"
+#include "priority.h"
+#include "mlfq.h"
+#include "workload.h"
+
+#define BENCH_DEFAULT_PROCESSES 1000000
+#define BENCH_LAYOUT_PASSES 20
+#define BENCH_DEFAULT_SIZES "1000,10000,100000,1000000"
+#define BENCH_MAX_SIZES 16
+#define BENCH_MAX_CASES 24
+#define BENCH_CHURN_OPERATIONS 50000
+#define BENCH_CHURN_LIVE 2048          // Allocations alive at once during the churn
+#define BENCH_CHURN_MEMORY (1 << 20)
+#define BENCH_CHURN_PAGE_SIZE 4096
+#define BENCH_LATENCY_OPERATIONS 10000 // Timed free/allocate pairs per case
+#define BENCH_LATENCY_MIN_BYTES 16
+#define BENCH_LATENCY_MAX_BYTES 1024   // Memory is this much per live block, so about half is used
+
+// Benchmark groups selected with -k
+#define BENCH_LAYOUT (1 << 0)
+#define BENCH_SCHEDULERS (1 << 1)
+#define BENCH_MEMORY (1 << 2)
+#define BENCH_ALLOCATORS (1 << 3)
+#define BENCH_LATENCY (1 << 4)
+
+// Schedulers the scaling benchmark runs
+typedef enum {
+    BENCH_SJF,
+    BENCH_ROUND_ROBIN,
+    BENCH_SRTF,
+    BENCH_PRIORITY,
+    BENCH_PRIORITY_PREEMPTIVE,
+    BENCH_MLFQ
+} BenchScheduler;
+
+// One scaling case; memory cases run the _with_memory variant
+typedef struct {
+    char name[32];
+    BenchScheduler scheduler;
+    bool memory;
+    AllocationAlgorithm alloc_alg;
+    PageReplacementAlgorithm page_alg;
+} BenchCase;
+
+// Measurements of one case at one size
+typedef struct {
+    double seconds;
+    long long events;
+    long peak_rss_kb;
+    bool ok;
+} BenchResult;
+
+// Process layout before the table was split into columns
+typedef struct {
+    int id;
+    int arrival_time;
+    int burst_time;
+    int remaining_time;
+    int completion_time;
+    int turnaround_time;
+    int waiting_time;
+    bool is_completed;
+    int memory_size;
+    int allocated_address;
+    int pages_needed;
+    int page_table[MAX_PROCESS_PAGES];
+} LegacyProcess;
+
+// Hardware cache-miss counter (fd is -1 when unavailable)
+typedef struct {
+    int fd;
+    struct timespec start;
+} BenchCounter;
+
+/**
+ * Start timing and, if possible, counting last-level cache misses
+ */
+static void counter_start(BenchCounter *counter) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    counter->fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (counter->fd >= 0) {
+        ioctl(counter->fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter->fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &counter->start);
+}
+
+/**
+ * Stop the counter, returns elapsed seconds and stores the miss count (-1 if unknown)
+ */
+static double counter_stop(BenchCounter *counter, long long *misses) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    *misses = -1;
+    if (counter->fd >= 0) {
+        ioctl(counter->fd, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counter->fd, misses, sizeof(*misses)) != sizeof(*misses)) *misses = -1;
+        close(counter->fd);
+    }
+    return (end.tv_sec - counter->start.tv_sec) + (end.tv_nsec - counter->start.tv_nsec) / 1e9;
+}
+
+/**
+ * Print one benchmark result line
+ */
+static void print_result(const char *name, double seconds, long long misses, long long elements) {
+    printf("%-22s %10.2f ns/process", name, seconds * 1e9 / elements);
+    if (misses >= 0) {
+        printf(" %10.3f misses/process\n", (double)misses / elements);
+    } else {
+        printf("     (cache counters unavailable)\n");
+    }
+}
+
+/**
+ * Ready-process selection scan over the old array-of-structs layout
+ */
+static int select_shortest_legacy(const LegacyProcess processes[], int n, int current_time) {
+    int shortest = -1;
+    int shortest_burst = INT_MAX;
+    for (int i = 0; i < n; i++) {
+        if (processes[i].arrival_time <= current_time && !processes[i].is_completed &&
+            processes[i].burst_time < shortest_burst) {
+            shortest_burst = processes[i].burst_time;
+            shortest = i;
+        }
+    }
+    return shortest;
+}
+
+/**
+ * Ready-process selection scan over the column layout
+ */
+static int select_shortest_table(const ProcessTable *table, int current_time) {
+    const int *arrival_time = table->arrival_time;
+    const int *burst_time = table->burst_time;
+    const bool *is_completed = table->is_completed;
+    int shortest = -1;
+    int shortest_burst = INT_MAX;
+    for (int i = 0; i < table->count; i++) {
+        if (arrival_time[i] <= current_time && !is_completed[i] && burst_time[i] < shortest_burst) {
+            shortest_burst = burst_time[i];
+            shortest = i;
+        }
+    }
+    return shortest;
+}
+
+/**
+ * Compare the two process layouts on repeated full-table scans
+ */
+static void bench_layout(int n) {
+    Arena arena;
+    ProcessTable table;
+    LegacyProcess *legacy = (LegacyProcess *)malloc((size_t)n * sizeof(LegacyProcess));
+    BenchCounter counter;
+    double seconds;
+    long long misses;
+    long long checksum = 0;
+
+    arena_init(&arena);
+    process_table_init(&table, &arena, n);
+    srand(42);
+    for (int i = 0; i < n; i++) {
+        memset(&legacy[i], 0, sizeof(legacy[i]));
+        legacy[i].id = table.id[i] = i + 1;
+        legacy[i].arrival_time = table.arrival_time[i] = i / 4;
+        legacy[i].burst_time = table.burst_time[i] = 1 + rand() % 100;
+        legacy[i].is_completed = table.is_completed[i] = false;
+    }
+
+    printf("---Process Table Layout (%d processes, %d scans)---\n", n, BENCH_LAYOUT_PASSES);
+    printf("Bytes read per process: struct layout %zu, column layout %zu\n",
+           sizeof(LegacyProcess), 2 * sizeof(int) + sizeof(bool));
+
+    counter_start(&counter);
+    for (int pass = 0; pass < BENCH_LAYOUT_PASSES; pass++) {
+        checksum += select_shortest_legacy(legacy, n, n / 8 + pass);
+    }
+    seconds = counter_stop(&counter, &misses);
+    print_result("Array of structs", seconds, misses, (long long)n * BENCH_LAYOUT_PASSES);
+
+    counter_start(&counter);
+    for (int pass = 0; pass < BENCH_LAYOUT_PASSES; pass++) {
+        checksum -= select_shortest_table(&table, n / 8 + pass);
+    }
+    seconds = counter_stop(&counter, &misses);
+    print_result("Structure of arrays", seconds, misses, (long long)n * BENCH_LAYOUT_PASSES);
+
+    if (checksum != 0) {
+        printf("Warning: layouts selected different processes\n");
+    }
+    printf("\n");
+
+    free(legacy);
+    arena_free(&arena);
+}
+
+/**
+ * Contiguous allocation as it was before specialization and the free tree: the whole
+ * block list is walked and the algorithm is tested for every block visited
+ */
+static __attribute__((noinline))
+bool allocate_contiguous_generic(MemoryManager *mm, ProcessTable *processes, int i, AllocationAlgorithm algorithm) {
+    int memory_size = processes->memory_size[i];
+    MemoryBlock *best_block = NULL;
+
+    for (MemoryBlock *current = mm->memory_blocks; current != NULL; current = current->next) {
+        if (current->process_id == -1 && current->size >= memory_size) {
+            if (algorithm == FIRST_FIT) {
+                best_block = current;
+                break;
+            } else if (algorithm == BEST_FIT) {
+                if (best_block == NULL || current->size < best_block->size) best_block = current;
+            } else if (algorithm == WORST_FIT) {
+                if (best_block == NULL || current->size > best_block->size) best_block = current;
+            }
+        }
+    }
+    if (best_block == NULL) return false;
+
+    claim_memory_block(mm, processes, i, best_block);
+    return true;
+}
+
+/**
+ * Contiguous deallocation as it was before block handles: the list is scanned from the
+ * head for the process's block
+ */
+static __attribute__((noinline))
+void deallocate_contiguous_generic(MemoryManager *mm, ProcessTable *processes, int i) {
+    if (processes->allocated_address[i] == -1) return;
+
+    for (MemoryBlock *current = mm->memory_blocks; current != NULL; current = current->next) {
+        if (current->start_address == processes->allocated_address[i] && current->process_id == processes->id[i]) {
+            release_memory_block(mm, current);
+            break;
+        }
+    }
+    processes->memory_block[i] = NULL;
+    processes->allocated_address[i] = -1;
+}
+
+/**
+ * Paging as it was before specialization: the algorithm is tested for every page
+ */
+static __attribute__((noinline))
+bool allocate_pages_generic(MemoryManager *mm, ProcessTable *processes, int i, PageReplacementAlgorithm algorithm) {
+    int *page_table = process_page_table(processes, i);
+
+    for (int page = 0; page < processes->pages_needed[i]; page++) {
+        int free_frame = -1;
+        for (int f = 0; f < mm->num_pages; f++) {
+            if (mm->page_frames.process_id[f] == -1) {
+                free_frame = f;
+                break;
+            }
+        }
+
+        if (free_frame == -1) {
+            mm->page_replacements++;
+            if (algorithm == FIFO) {
+                free_frame = mm->fifo_queue[mm->fifo_front];
+                mm->fifo_front = (mm->fifo_front + 1) % mm->num_pages;
+            } else if (algorithm == LRU) {
+                free_frame = find_lru_page(mm);
+            }
+        }
+
+        mm->page_frames.process_id[free_frame] = processes->id[i];
+        mm->page_frames.page_number[free_frame] = (unsigned short)page;
+        mm->page_frames.last_access_time[free_frame] = mm->current_time++;
+        page_table[page] = free_frame;
+        if (algorithm == FIFO) {
+            mm->fifo_queue[mm->fifo_rear] = free_frame;
+            mm->fifo_rear = (mm->fifo_rear + 1) % mm->num_pages;
+        }
+    }
+    return true;
+}
+
+/**
+ * Allocate every process in turn, freeing the one BENCH_CHURN_LIVE allocations back
+ * Returns elapsed seconds and adds the placements to checksum.
+ */
+static double run_churn(ProcessTable *processes, AllocationAlgorithm alloc_alg, PageReplacementAlgorithm page_alg,
+                        bool specialized, long long *checksum) {
+    ContiguousAllocator allocate_contiguous = contiguous_allocator(alloc_alg);
+    PageAllocator allocate = page_allocator(page_alg);
+    MemoryManager mm;
+    BenchCounter counter;
+    long long misses;
+
+    process_table_reset(processes);
+    init_memory_manager(&mm, BENCH_CHURN_MEMORY, BENCH_CHURN_PAGE_SIZE);
+
+    counter_start(&counter);
+    for (int i = 0; i < processes->count; i++) {
+        if (i >= BENCH_CHURN_LIVE) {
+            if (specialized) {
+                deallocate_memory_contiguous(&mm, processes, i - BENCH_CHURN_LIVE);
+            } else {
+                deallocate_contiguous_generic(&mm, processes, i - BENCH_CHURN_LIVE);
+            }
+            deallocate_pages(&mm, processes, i - BENCH_CHURN_LIVE);
+        }
+        if (specialized) {
+            allocate_contiguous(&mm, processes, i);
+            allocate(&mm, processes, i);
+        } else {
+            allocate_contiguous_generic(&mm, processes, i, alloc_alg);
+            allocate_pages_generic(&mm, processes, i, page_alg);
+        }
+    }
+    double seconds = counter_stop(&counter, &misses);
+
+    for (int i = 0; i < processes->count; i++) {
+        *checksum += processes->allocated_address[i] + process_page_table(processes, i)[0];
+    }
+    cleanup_memory_manager(&mm);
+    return seconds;
+}
+
+/**
+ * Compare the generic and specialized allocation loops for every combination
+ */
+static void bench_allocators(const WorkloadSpec *workload) {
+    static const char *alloc_names[] = { "first", "best", "worst" };
+    static const char *page_names[] = { "fifo", "lru" };
+    WorkloadSpec spec = *workload;
+    Arena arena;
+    ProcessTable processes;
+
+    spec.count = BENCH_CHURN_OPERATIONS;
+    arena_init(&arena);
+    workload_fill_table(&spec, &arena, &processes);
+    process_table_set_page_size(&processes, BENCH_CHURN_PAGE_SIZE);
+
+    printf("---Allocator Specialization (%d allocations, %d live, %d bytes, %d-byte pages)---\n",
+           BENCH_CHURN_OPERATIONS, BENCH_CHURN_LIVE, BENCH_CHURN_MEMORY, BENCH_CHURN_PAGE_SIZE);
+    printf("%-14s %16s %18s %9s\n", "Case", "Generic ns/op", "Specialized ns/op", "Speedup");
+
+    for (int a = FIRST_FIT; a <= WORST_FIT; a++) {
+        for (int p = FIFO; p <= LRU; p++) {
+            long long generic_checksum = 0;
+            long long specialized_checksum = 0;
+            double generic = run_churn(&processes, (AllocationAlgorithm)a, (PageReplacementAlgorithm)p,
+                                       false, &generic_checksum);
+            double specialized = run_churn(&processes, (AllocationAlgorithm)a, (PageReplacementAlgorithm)p,
+                                           true, &specialized_checksum);
+            char name[32];
+
+            snprintf(name, sizeof(name), "%s/%s", alloc_names[a], page_names[p]);
+            printf("%-14s %16.1f %18.1f %8.2fx\n", name, generic * 1e9 / BENCH_CHURN_OPERATIONS,
+                   specialized * 1e9 / BENCH_CHURN_OPERATIONS, generic / specialized);
+            if (generic_checksum != specialized_checksum) {
+                printf("Warning: %s placements differ between the generic and specialized loops\n", name);
+            }
+        }
+    }
+    printf("\n");
+
+    arena_free(&arena);
+}
+
+/**
+ * Monotonic clock in nanoseconds
+ */
+static inline long long now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+/**
+ * Fill memory with live blocks, then time BENCH_LATENCY_OPERATIONS pairs of freeing a
+ * random live block and allocating a new one in its place
+ * First fit is filled through best fit, which places blocks the same way in empty memory
+ * without walking every block already placed.
+ * Returns the number of failed allocations.
+ */
+static int run_latency(int live, AllocationAlgorithm algorithm, Histogram *allocate_ns, Histogram *free_ns) {
+    ContiguousAllocator allocate = contiguous_allocator(algorithm);
+    ContiguousAllocator fill = contiguous_allocator(algorithm == FIRST_FIT ? BEST_FIT : algorithm);
+    int count = live + BENCH_LATENCY_OPERATIONS;
+    int *slots = (int *)malloc(live * sizeof(int));
+    int failed = 0;
+    Arena arena;
+    ProcessTable processes;
+    MemoryManager mm;
+
+    arena_init(&arena);
+    process_table_init(&processes, &arena, count);
+    srand(42);
+    for (int i = 0; i < count; i++) {
+        processes.id[i] = i + 1;
+        processes.memory_size[i] = BENCH_LATENCY_MIN_BYTES + rand() % (BENCH_LATENCY_MAX_BYTES - BENCH_LATENCY_MIN_BYTES + 1);
+    }
+    processes.count = count;
+    process_table_reset(&processes);
+    init_memory_manager(&mm, (long long)live * BENCH_LATENCY_MAX_BYTES, BENCH_CHURN_PAGE_SIZE);
+
+    for (int i = 0; i < live; i++) {
+        if (!fill(&mm, &processes, i)) failed++;
+        slots[i] = i;
+    }
+
+    for (int op = 0; op < BENCH_LATENCY_OPERATIONS; op++) {
+        int slot = rand() % live;
+        int next = live + op;
+
+        long long start = now_ns();
+        deallocate_memory_contiguous(&mm, &processes, slots[slot]);
+        long long middle = now_ns();
+        bool allocated = allocate(&mm, &processes, next);
+        long long end = now_ns();
+
+        histogram_record(free_ns, middle - start);
+        histogram_record(allocate_ns, end - middle);
+        if (!allocated) failed++;
+        slots[slot] = next;
+    }
+
+    cleanup_memory_manager(&mm);
+    arena_free(&arena);
+    free(slots);
+    return failed;
+}
+
+/**
+ * Per-operation latency of first fit, best fit and TLSF with many live blocks
+ */
+static void bench_latency(void) {
+    static const AllocationAlgorithm algorithms[] = { FIRST_FIT, BEST_FIT, TLSF };
+    static const char *alloc_names[] = { "first", "best", "tlsf" };
+    static const int lives[] = { 10000, 100000, 1000000 };
+
+    printf("---Allocation Latency (%d free/allocate pairs, %d-%d byte requests, %d bytes per live block)---\n",
+           BENCH_LATENCY_OPERATIONS, BENCH_LATENCY_MIN_BYTES, BENCH_LATENCY_MAX_BYTES, BENCH_LATENCY_MAX_BYTES);
+    printf("%-10s %-6s %10s %10s %10s %10s %10s %10s %10s %7s\n", "Live", "Alg",
+           "Alloc p50", "p99", "p99.9", "max ns", "Free p50", "p99", "max ns", "Failed");
+
+    for (int l = 0; l < 3; l++) {
+        for (int a = 0; a < 3; a++) {
+            Histogram allocate_ns;
+            Histogram free_ns;
+            histogram_init(&allocate_ns);
+            histogram_init(&free_ns);
+
+            int failed = run_latency(lives[l], algorithms[a], &allocate_ns, &free_ns);
+            printf("%-10d %-6s %10lld %10lld %10lld %10lld %10lld %10lld %10lld %7d\n", lives[l], alloc_names[a],
+                   histogram_percentile(&allocate_ns, 50), histogram_percentile(&allocate_ns, 99),
+                   histogram_percentile(&allocate_ns, 99.9), allocate_ns.max,
+                   histogram_percentile(&free_ns, 50), histogram_percentile(&free_ns, 99), free_ns.max, failed);
+            fflush(stdout);
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * Run one case on a generated table (called in the child process)
+ */
+static void run_case(const BenchCase *bench_case, ProcessTable *processes, GanttSink *gantt, MemoryManager *mm) {
+    MlfqConfig config;
+
+    switch (bench_case->scheduler) {
+        case BENCH_SJF:
+            if (bench_case->memory) {
+                sjf_with_memory(processes, gantt, mm, bench_case->alloc_alg, bench_case->page_alg);
+            } else {
+                sjf_schedule(processes, gantt);
+            }
+            break;
+        case BENCH_ROUND_ROBIN:
+            if (bench_case->memory) {
+                round_robin_with_memory(processes, gantt, mm, bench_case->alloc_alg, bench_case->page_alg, TIME_QUANTUM);
+            } else {
+                round_robin_schedule(processes, gantt, TIME_QUANTUM);
+            }
+            break;
+        case BENCH_SRTF:
+            srtf_schedule(processes, gantt);
+            break;
+        case BENCH_PRIORITY:
+            priority_schedule(processes, gantt, AGING_INTERVAL);
+            break;
+        case BENCH_PRIORITY_PREEMPTIVE:
+            priority_preemptive_schedule(processes, gantt, AGING_INTERVAL);
+            break;
+        case BENCH_MLFQ:
+            mlfq_default_config(&config);
+            mlfq_schedule(processes, gantt, &config);
+            break;
+    }
+}
+
+/**
+ * Run one case in a forked child so its peak RSS is measured on its own
+ */
+static BenchResult measure_case(const BenchCase *bench_case, const WorkloadSpec *spec) {
+    BenchResult result;
+    int fds[2];
+
+    memset(&result, 0, sizeof(result));
+    fflush(stdout);
+    if (pipe(fds) != 0) return result;
+
+    pid_t child = fork();
+    if (child < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return result;
+    }
+
+    if (child == 0) {
+        Arena arena;
+        ProcessTable processes;
+        GanttCounter gantt;
+        MemoryManager mm;
+        BenchCounter counter;
+        long long misses;
+
+        close(fds[0]);
+        arena_init(&arena);
+        workload_fill_table(spec, &arena, &processes);
+        init_memory_manager(&mm, MEMORY_SIZE, PAGE_SIZE);
+        mm.print_warnings = false;
+        gantt_counter_init(&gantt);
+
+        // Only the scheduler itself is timed, not the workload generation
+        counter_start(&counter);
+        run_case(bench_case, &processes, &gantt.sink, &mm);
+        result.seconds = counter_stop(&counter, &misses);
+        result.events = gantt.total;
+        result.ok = true;
+
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == (ssize_t)sizeof(result) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    ssize_t received = read(fds[0], &result, sizeof(result));
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+    if (wait4(child, &status, 0, &usage) == child && received == (ssize_t)sizeof(result) &&
+        WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        result.peak_rss_kb = usage.ru_maxrss;
+    } else {
+        result.ok = false;
+    }
+    return result;
+}
+
+/**
+ * Time a list of cases at every size
+ */
+static void bench_scaling(const char *title, const BenchCase cases[], int num_cases,
+                          const long long sizes[], int num_sizes, const WorkloadSpec *base_spec) {
+    static const char *arrival_names[] = { "Poisson", "bursty" };
+    static const char *burst_names[] = { "exponential", "Pareto", "bimodal" };
+    double previous[BENCH_MAX_CASES];
+
+    printf("---%s (%s arrivals, %s bursts, load %.2f, seed %llu)---\n", title,
+           arrival_names[base_spec->arrivals], burst_names[base_spec->bursts], base_spec->load,
+           (unsigned long long)base_spec->seed);
+    printf("%-12s %-24s %12s %12s %12s %12s %8s\n", "Processes", "Case", "Time (ms)", "Events",
+           "ns/event", "Peak RSS MB", "Growth");
+
+    for (int s = 0; s < num_sizes; s++) {
+        WorkloadSpec spec = *base_spec;
+        spec.count = sizes[s];
+
+        for (int c = 0; c < num_cases; c++) {
+            BenchResult result = measure_case(&cases[c], &spec);
+            if (!result.ok) {
+                printf("%-12lld %-24s %12s\n", sizes[s], cases[c].name, "failed");
+                previous[c] = 0;
+                continue;
+            }
+
+            // Growth: cost per event relative to the previous size (about 1 when linear)
+            double ns_per_event = result.seconds * 1e9 / (result.events > 0 ? result.events : 1);
+            printf("%-12lld %-24s %12.2f %12lld %12.1f %12.1f", sizes[s], cases[c].name, result.seconds * 1e3,
+                   result.events, ns_per_event, result.peak_rss_kb / 1024.0);
+            if (s > 0 && previous[c] > 0) {
+                printf(" %7.2fx\n", ns_per_event / previous[c]);
+            } else {
+                printf(" %8s\n", "-");
+            }
+            previous[c] = ns_per_event;
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * Build the scheduler cases, or the SJF/Round Robin allocation and paging cases
+ * Returns the number of cases.
+ */
+static int build_cases(BenchCase cases[], bool memory) {
+    static const char *scheduler_names[] = { "sjf", "rr", "srtf", "priority", "priority_preemptive", "mlfq" };
+    static const char *alloc_names[] = { "first", "best", "worst", "buddy", "tlsf" };
+    static const char *page_names[] = { "fifo", "lru" };
+    int count = 0;
+
+    if (!memory) {
+        for (int s = BENCH_SJF; s <= BENCH_MLFQ; s++) {
+            memset(&cases[count], 0, sizeof(BenchCase));
+            snprintf(cases[count].name, sizeof(cases[count].name), "%s", scheduler_names[s]);
+            cases[count].scheduler = (BenchScheduler)s;
+            count++;
+        }
+        return count;
+    }
+
+    for (int s = BENCH_SJF; s <= BENCH_ROUND_ROBIN; s++) {
+        for (int a = FIRST_FIT; a <= TLSF; a++) {
+            for (int p = FIFO; p <= LRU; p++) {
+                memset(&cases[count], 0, sizeof(BenchCase));
+                snprintf(cases[count].name, sizeof(cases[count].name), "%s %s/%s",
+                         scheduler_names[s], alloc_names[a], page_names[p]);
+                cases[count].scheduler = (BenchScheduler)s;
+                cases[count].memory = true;
+                cases[count].alloc_alg = (AllocationAlgorithm)a;
+                cases[count].page_alg = (PageReplacementAlgorithm)p;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Parse a comma separated list of sizes (1000 or 1e3)
+ * Returns the number of sizes, or -1 on error.
+ */
+static int parse_sizes(const char *text, long long sizes[]) {
+    int count = 0;
+    const char *cursor = text;
+
+    while (count < BENCH_MAX_SIZES) {
+        char *end;
+        double value = strtod(cursor, &end);
+        if (end == cursor || value < 1 || value > INT_MAX) break;
+        sizes[count++] = (long long)value;
+
+        if (*end == '\0') return count;
+        if (*end != ',') break;
+        cursor = end + 1;
+    }
+
+    printf("Error: Invalid size list '%s'\n", text);
+    return -1;
+}
+
+/**
+ * Parse the -k list of benchmark groups
+ * Returns the selected groups, or 0 on error.
+ */
+static int parse_groups(const char *text) {
+    static const char *names[] = { "layout", "schedulers", "memory", "allocators", "latency" };
+    int groups = 0;
+    const char *cursor = text;
+
+    while (true) {
+        size_t length = strcspn(cursor, ",");
+        int match = -1;
+        for (int i = 0; i < 5; i++) {
+            if (strlen(names[i]) == length && strncmp(cursor, names[i], length) == 0) match = i;
+        }
+        if (match < 0) {
+            printf("Error: Unknown benchmark list '%s'\n", text);
+            return 0;
+        }
+        groups |= 1 << match;
+
+        if (cursor[length] == '\0') return groups;
+        cursor += length + 1;
+    }
+}
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    WorkloadSpec spec;
+    long long sizes[BENCH_MAX_SIZES];
+    int num_sizes = parse_sizes(BENCH_DEFAULT_SIZES, sizes);
+    int groups = BENCH_LAYOUT | BENCH_SCHEDULERS | BENCH_MEMORY | BENCH_ALLOCATORS | BENCH_LATENCY;
+    int option;
+
+    workload_default_spec(&spec);
+    while ((option = getopt(argc, argv, "k:n:" WORKLOAD_OPTIONS)) != -1) {
+        bool ok = true;
+        if (option == 'k') {
+            groups = parse_groups(optarg);
+            ok = groups != 0;
+        } else if (option == 'n') {
+            num_sizes = parse_sizes(optarg, sizes);
+            ok = num_sizes > 0;
+        } else {
+            ok = workload_parse_option(&spec, option, optarg);
+        }
+        if (!ok) {
+            optind = -1;
+            break;
+        }
+    }
+
+    int n = (optind >= 0 && optind < argc) ? atoi(argv[optind]) : BENCH_DEFAULT_PROCESSES;
+    if (optind < 0 || n <= 0 || !workload_check_spec(&spec)) {
+        printf("Usage: %s [-k layout,schedulers,memory,allocators,latency] [-n sizes] " WORKLOAD_USAGE " [num_processes]\n", argv[0]);
+        return 1;
+    }
+
+    if (groups & BENCH_LAYOUT) {
+        bench_layout(n);
+    }
+
+    BenchCase cases[BENCH_MAX_CASES];
+    if (groups & BENCH_SCHEDULERS) {
+        int num_cases = build_cases(cases, false);
+        bench_scaling("Scheduler Scaling", cases, num_cases, sizes, num_sizes, &spec);
+    }
+    if (groups & BENCH_MEMORY) {
+        int num_cases = build_cases(cases, true);
+        bench_scaling("Memory Management Scaling", cases, num_cases, sizes, num_sizes, &spec);
+    }
+    if (groups & BENCH_ALLOCATORS) {
+        bench_allocators(&spec);
+    }
+    if (groups & BENCH_LATENCY) {
+        bench_latency();
+    }
+    return 0;
+}
@@ -0,0 +1,269 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Multi-algorithm comparison driver
+
+ * The trace is loaded once. Each selected algorithm runs on its own thread against a
+ * private copy of the process table (the trace columns are shared read-only), and one
+ * summary row per algorithm is printed as CSV or JSON instead of the full reports.
+ * With -g, each single-CPU timeline is also streamed to <prefix>.<algorithm>.gantt.
+
+ * Usage: ./compare [-a sjf,rr,srtf,priority,priority_preemptive,mlfq,smp] [-f csv|json] [-g prefix] [trace]
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "sjf.h"
+#include "round_robin.h"
+#include "srtf.h"
+#include "priority.h"
+#include "mlfq.h"
+#include "smp.h"
+
+#define COMPARE_MAX_ALGORITHMS 16
+#define COMPARE_MAX_PATH 4096
+
+// A scheduler run with its default settings; slices go to the sink and the
+// return value counts dispatches made outside it (the SMP cores keep their own charts)
+typedef struct {
+    const char *name;
+    int (*run)(ProcessTable *processes, GanttSink *gantt);
+    bool single_cpu; // Run by default; multi-CPU runs are only compared when selected
+} CompareAlgorithm;
+
+// One algorithm's run and its summary
+typedef struct {
+    const CompareAlgorithm *algorithm;
+    const ProcessTable *processes;
+    const char *gantt_prefix; // Write the timeline to <prefix>.<algorithm>.gantt, or NULL
+    double average_waiting;
+    double average_turnaround;
+    long long p50_waiting;
+    long long p99_waiting;
+    long long max_waiting;
+    long long p99_response;
+    int makespan;
+    int dispatches;
+} CompareTask;
+
+static int run_sjf(ProcessTable *processes, GanttSink *gantt) {
+    sjf_schedule(processes, gantt);
+    return 0;
+}
+
+static int run_round_robin(ProcessTable *processes, GanttSink *gantt) {
+    round_robin_schedule(processes, gantt, TIME_QUANTUM);
+    return 0;
+}
+
+static int run_srtf(ProcessTable *processes, GanttSink *gantt) {
+    srtf_schedule(processes, gantt);
+    return 0;
+}
+
+static int run_priority(ProcessTable *processes, GanttSink *gantt) {
+    priority_schedule(processes, gantt, AGING_INTERVAL);
+    return 0;
+}
+
+static int run_priority_preemptive(ProcessTable *processes, GanttSink *gantt) {
+    priority_preemptive_schedule(processes, gantt, AGING_INTERVAL);
+    return 0;
+}
+
+static int run_mlfq(ProcessTable *processes, GanttSink *gantt) {
+    MlfqConfig config;
+    mlfq_default_config(&config);
+    mlfq_schedule(processes, gantt, &config);
+    return 0;
+}
+
+static int run_smp(ProcessTable *processes, GanttSink *gantt) {
+    SmpConfig config;
+    smp_default_config(&config);
+    config.num_threads = 1; // The comparison already runs one thread per algorithm
+    (void)gantt;
+
+    SmpCore *cores = smp_create_cores(config.num_cores);
+    smp_schedule(processes, cores, &config);
+    int dispatches = 0;
+    for (int c = 0; c < config.num_cores; c++) {
+        dispatches += cores[c].slices;
+    }
+    smp_free_cores(cores, config.num_cores);
+    return dispatches;
+}
+
+static const CompareAlgorithm algorithms[] = {
+    { "sjf", run_sjf, true },
+    { "rr", run_round_robin, true },
+    { "srtf", run_srtf, true },
+    { "priority", run_priority, true },
+    { "priority_preemptive", run_priority_preemptive, true },
+    { "mlfq", run_mlfq, true },
+    { "smp", run_smp, false },
+};
+static const int num_algorithms = sizeof(algorithms) / sizeof(algorithms[0]);
+
+/**
+ * Comparison thread: run one algorithm on a private copy of the table
+ */
+static void *compare_worker(void *arg) {
+    CompareTask *task = (CompareTask *)arg;
+    Arena arena;
+    ProcessTable processes;
+    GanttCounter counter;
+    GanttFileSink file_sink;
+    GanttSink *gantt = &counter.sink;
+
+    arena_init(&arena);
+    process_table_clone(&processes, task->processes, &arena);
+
+    // Only the dispatch count is kept unless the timeline is written out
+    gantt_counter_init(&counter);
+    if (task->gantt_prefix != NULL && task->algorithm->single_cpu) {
+        char filename[COMPARE_MAX_PATH];
+        snprintf(filename, sizeof(filename), "%s.%s.gantt", task->gantt_prefix, task->algorithm->name);
+        if (gantt_file_sink_open(&file_sink, filename)) {
+            gantt = &file_sink.sink;
+        }
+    }
+
+    task->dispatches = task->algorithm->run(&processes, gantt);
+    gantt_close(gantt);
+    task->dispatches += (int)((gantt == &file_sink.sink) ? file_sink.total : counter.total);
+
+    compute_average_times(&processes, &task->average_waiting, &task->average_turnaround);
+    task->p50_waiting = histogram_percentile(&processes.metrics->waiting_time, 50.0);
+    task->p99_waiting = histogram_percentile(&processes.metrics->waiting_time, 99.0);
+    task->max_waiting = processes.metrics->waiting_time.max;
+    task->p99_response = histogram_percentile(&processes.metrics->response_time, 99.0);
+    task->makespan = 0;
+    for (int i = 0; i < processes.count; i++) {
+        if (processes.completion_time[i] > task->makespan) task->makespan = processes.completion_time[i];
+    }
+
+    arena_free(&arena);
+    return NULL;
+}
+
+/**
+ * Parse a comma separated list of algorithm names
+ * Returns the number of algorithms, or -1 on error.
+ */
+static int parse_algorithms(const char *text, const CompareAlgorithm *selected[]) {
+    int count = 0;
+    const char *cursor = text;
+
+    while (true) {
+        size_t length = strcspn(cursor, ",");
+        const CompareAlgorithm *match = NULL;
+        for (int i = 0; i < num_algorithms; i++) {
+            if (strlen(algorithms[i].name) == length && strncmp(cursor, algorithms[i].name, length) == 0) {
+                match = &algorithms[i];
+            }
+        }
+        if (match == NULL || count == COMPARE_MAX_ALGORITHMS) {
+            printf("Error: Unknown algorithm list '%s'\n", text);
+            return -1;
+        }
+        selected[count++] = match;
+
+        if (cursor[length] == '\0') return count;
+        cursor += length + 1;
+    }
+}
+
+/**
+ * Print one row per algorithm as CSV
+ */
+static void print_csv(const CompareTask tasks[], int num_tasks, int num_processes) {
+    printf("algorithm,processes,average_waiting,average_turnaround,max_waiting,makespan,dispatches,"
+           "p50_waiting,p99_waiting,p99_response\n");
+    for (int t = 0; t < num_tasks; t++) {
+        printf("%s,%d,%.2f,%.2f,%lld,%d,%d,%lld,%lld,%lld\n", tasks[t].algorithm->name, num_processes,
+               tasks[t].average_waiting, tasks[t].average_turnaround,
+               tasks[t].max_waiting, tasks[t].makespan, tasks[t].dispatches,
+               tasks[t].p50_waiting, tasks[t].p99_waiting, tasks[t].p99_response);
+    }
+}
+
+/**
+ * Print one object per algorithm as a JSON array
+ */
+static void print_json(const CompareTask tasks[], int num_tasks, int num_processes) {
+    printf("[\n");
+    for (int t = 0; t < num_tasks; t++) {
+        printf("  {\"algorithm\": \"%s\", \"processes\": %d, \"average_waiting\": %.2f, "
+               "\"average_turnaround\": %.2f, \"max_waiting\": %lld, \"makespan\": %d, \"dispatches\": %d, "
+               "\"p50_waiting\": %lld, \"p99_waiting\": %lld, \"p99_response\": %lld}%s\n",
+               tasks[t].algorithm->name, num_processes, tasks[t].average_waiting, tasks[t].average_turnaround,
+               tasks[t].max_waiting, tasks[t].makespan, tasks[t].dispatches,
+               tasks[t].p50_waiting, tasks[t].p99_waiting, tasks[t].p99_response, (t + 1 < num_tasks) ? "," : "");
+    }
+    printf("]\n");
+}
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const CompareAlgorithm *selected[COMPARE_MAX_ALGORITHMS];
+    int num_selected = 0;
+    bool json = false;
+    const char *gantt_prefix = NULL;
+    int option;
+
+    for (int i = 0; i < num_algorithms; i++) {
+        if (algorithms[i].single_cpu) selected[num_selected++] = &algorithms[i];
+    }
+
+    while ((option = getopt(argc, argv, "a:f:g:")) != -1) {
+        if (option == 'a') {
+            num_selected = parse_algorithms(optarg, selected);
+            if (num_selected < 0) return 1;
+        } else if (option == 'f' && (strcmp(optarg, "csv") == 0 || strcmp(optarg, "json") == 0)) {
+            json = (strcmp(optarg, "json") == 0);
+        } else if (option == 'g') {
+            gantt_prefix = optarg;
+        } else {
+            printf("Usage: %s [-a sjf,rr,srtf,priority,priority_preemptive,mlfq,smp] [-f csv|json] [-g prefix] [trace]\n", argv[0]);
+            return 1;
+        }
+    }
+    const char *filename = (optind < argc) ? argv[optind] : "processes.txt";
+
+    // The trace is read once; every run shares its columns read-only
+    Arena arena;
+    ProcessTable processes;
+    arena_init(&arena);
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        arena_free(&arena);
+        return 1;
+    }
+
+    // Run the selected algorithms concurrently, one thread each
+    CompareTask tasks[COMPARE_MAX_ALGORITHMS];
+    pthread_t threads[COMPARE_MAX_ALGORITHMS];
+    for (int t = 0; t < num_selected; t++) {
+        tasks[t].algorithm = selected[t];
+        tasks[t].processes = &processes;
+        tasks[t].gantt_prefix = gantt_prefix;
+        pthread_create(&threads[t], NULL, compare_worker, &tasks[t]);
+    }
+    for (int t = 0; t < num_selected; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    if (json) {
+        print_json(tasks, num_selected, processes.count);
+    } else {
+        print_csv(tasks, num_selected, processes.count);
+    }
+
+    arena_free(&arena);
+    return 0;
+}
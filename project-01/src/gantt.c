@@ -0,0 +1,279 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Gantt sinks shared by the schedulers
+
+ * A scheduler reports each slice it runs to a GanttSink. The in-memory chart keeps
+ * every entry for later use, the text sink prints the familiar chart, the file sink
+ * streams fixed-size binary blocks to disk and the counter only counts. All of them
+ * merge a slice into the previous entry when the same process simply kept running,
+ * and the text and file sinks use a fixed amount of memory however long the run is.
+ */
+
+#include <string.h>
+#include "gantt.h"
+
+/**
+ * Whether a slice continues an entry (same process, no gap)
+ */
+static bool gantt_extends(const GanttEntry *last, int process_id, int start_time) {
+    return last->process_id == process_id && last->end_time == start_time;
+}
+
+/**
+ * Finish a run: write out anything a sink still buffers
+ */
+void gantt_close(GanttSink *sink) {
+    if (sink->close != NULL) {
+        sink->close(sink);
+    }
+}
+
+/**
+ * In-memory sink: append or extend the last entry, growing the chart as needed
+ */
+static void gantt_chart_add(GanttSink *sink, int process_id, int start_time, int end_time) {
+    GanttChart *gantt = (GanttChart *)sink;
+
+    if (gantt->count > 0 && gantt_extends(&gantt->entries[gantt->count - 1], process_id, start_time)) {
+        gantt->entries[gantt->count - 1].end_time = end_time;
+        return;
+    }
+
+    if (gantt->count == gantt->capacity) {
+        gantt->entries = (GanttEntry *)arena_grow_array(gantt->arena, gantt->entries,
+                                                        &gantt->capacity, sizeof(GanttEntry));
+    }
+
+    gantt->entries[gantt->count].process_id = process_id;
+    gantt->entries[gantt->count].start_time = start_time;
+    gantt->entries[gantt->count].end_time = end_time;
+    gantt->count++;
+}
+
+/**
+ * Initialize an empty Gantt chart
+ */
+void gantt_init(GanttChart *gantt, Arena *arena) {
+    gantt->sink.add = gantt_chart_add;
+    gantt->sink.close = NULL;
+    gantt->entries = NULL;
+    gantt->count = 0;
+    gantt->capacity = 0;
+    gantt->arena = arena;
+}
+
+/**
+ * Empty a chart for another run, keeping its storage
+ */
+void gantt_clear(GanttChart *gantt) {
+    gantt->count = 0;
+}
+
+/**
+ * Print one row of the chart: process ids, then the boundary times
+ */
+static void print_gantt_row(FILE *out, const GanttEntry gantt[], int gantt_count) {
+    fprintf(out, "|");
+    for (int i = 0; i < gantt_count; i++) {
+        fprintf(out, " P%d |", gantt[i].process_id);
+    }
+    fprintf(out, "\n");
+    fprintf(out, "%d", gantt[0].start_time);
+    for (int i = 0; i < gantt_count; i++) {
+        fprintf(out, "    %d", gantt[i].end_time);
+    }
+    fprintf(out, "\n");
+}
+
+/**
+ * Text sink: print the buffered row
+ */
+static void gantt_text_flush(GanttTextSink *text) {
+    if (!text->header_printed) {
+        fprintf(text->out, "\nGantt Chart:\n");
+        text->header_printed = true;
+    }
+    if (text->count > 0) {
+        print_gantt_row(text->out, text->row, text->count);
+        text->count = 0;
+    }
+}
+
+/**
+ * Text sink: buffer a slice, printing the row once it is full
+ */
+static void gantt_text_add(GanttSink *sink, int process_id, int start_time, int end_time) {
+    GanttTextSink *text = (GanttTextSink *)sink;
+
+    if (text->count > 0 && gantt_extends(&text->row[text->count - 1], process_id, start_time)) {
+        text->row[text->count - 1].end_time = end_time;
+        return;
+    }
+
+    // A full row is only printed once the next slice cannot extend its last entry
+    if (text->count == GANTT_TEXT_ROW_ENTRIES) {
+        gantt_text_flush(text);
+    }
+    text->row[text->count].process_id = process_id;
+    text->row[text->count].start_time = start_time;
+    text->row[text->count].end_time = end_time;
+    text->count++;
+}
+
+/**
+ * Text sink: print the last row and end the chart
+ */
+static void gantt_text_close(GanttSink *sink) {
+    GanttTextSink *text = (GanttTextSink *)sink;
+
+    gantt_text_flush(text);
+    fprintf(text->out, "\n");
+    text->header_printed = false;
+}
+
+/**
+ * Initialize a text sink printing to a stream
+ */
+void gantt_text_sink_init(GanttTextSink *text, FILE *out) {
+    text->sink.add = gantt_text_add;
+    text->sink.close = gantt_text_close;
+    text->out = out;
+    text->count = 0;
+    text->header_printed = false;
+}
+
+/**
+ * File sink: write the buffered block
+ */
+static void gantt_file_flush(GanttFileSink *file_sink) {
+    if (file_sink->count == 0 || file_sink->failed) return;
+
+    if (fwrite(file_sink->block, sizeof(GanttEntry), file_sink->count, file_sink->file) != (size_t)file_sink->count) {
+        printf("Error: Could not write Gantt entries\n");
+        file_sink->failed = true;
+    }
+    file_sink->count = 0;
+}
+
+/**
+ * File sink: buffer a slice, writing the block once it is full
+ */
+static void gantt_file_add(GanttSink *sink, int process_id, int start_time, int end_time) {
+    GanttFileSink *file_sink = (GanttFileSink *)sink;
+
+    if (file_sink->count > 0 && gantt_extends(&file_sink->block[file_sink->count - 1], process_id, start_time)) {
+        file_sink->block[file_sink->count - 1].end_time = end_time;
+        return;
+    }
+
+    // A full block is only written once the next slice cannot extend its last entry
+    if (file_sink->count == GANTT_BLOCK_ENTRIES) {
+        gantt_file_flush(file_sink);
+    }
+    file_sink->block[file_sink->count].process_id = process_id;
+    file_sink->block[file_sink->count].start_time = start_time;
+    file_sink->block[file_sink->count].end_time = end_time;
+    file_sink->count++;
+    file_sink->total++;
+}
+
+/**
+ * Write a binary Gantt file header
+ */
+static bool write_gantt_header(FILE *file, uint64_t count) {
+    GanttFileHeader header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, GANTT_FILE_MAGIC, sizeof(header.magic));
+    header.version = GANTT_FILE_VERSION;
+    header.entry_size = sizeof(GanttEntry);
+    header.count = count;
+    return fwrite(&header, sizeof(header), 1, file) == 1;
+}
+
+/**
+ * File sink: write the last block, record the entry count and close the file
+ */
+static void gantt_file_close(GanttSink *sink) {
+    GanttFileSink *file_sink = (GanttFileSink *)sink;
+
+    if (file_sink->file == NULL) return;
+
+    gantt_file_flush(file_sink);
+    if (!file_sink->failed) {
+        // The count is only known now; until then the header says 0
+        if (fseek(file_sink->file, 0, SEEK_SET) != 0 ||
+            !write_gantt_header(file_sink->file, (uint64_t)file_sink->total)) {
+            printf("Error: Could not finish Gantt file\n");
+            file_sink->failed = true;
+        }
+    }
+    if (fclose(file_sink->file) != 0) {
+        file_sink->failed = true;
+    }
+    file_sink->file = NULL;
+}
+
+/**
+ * Open a file sink, creating or truncating the file
+ */
+bool gantt_file_sink_open(GanttFileSink *file_sink, const char *filename) {
+    file_sink->sink.add = gantt_file_add;
+    file_sink->sink.close = gantt_file_close;
+    file_sink->count = 0;
+    file_sink->total = 0;
+    file_sink->failed = false;
+
+    file_sink->file = fopen(filename, "wb");
+    if (file_sink->file == NULL) {
+        printf("Error: Could not open file %s\n", filename);
+        return false;
+    }
+    if (!write_gantt_header(file_sink->file, 0)) {
+        printf("Error: Could not write file %s\n", filename);
+        fclose(file_sink->file);
+        file_sink->file = NULL;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Counting sink: count entries without keeping them
+ */
+static void gantt_counter_add(GanttSink *sink, int process_id, int start_time, int end_time) {
+    GanttCounter *counter = (GanttCounter *)sink;
+
+    if (counter->total == 0 || !gantt_extends(&counter->last, process_id, start_time)) {
+        counter->last.process_id = process_id;
+        counter->last.start_time = start_time;
+        counter->total++;
+    }
+    counter->last.end_time = end_time;
+}
+
+/**
+ * Initialize a counting sink
+ */
+void gantt_counter_init(GanttCounter *counter) {
+    counter->sink.add = gantt_counter_add;
+    counter->sink.close = NULL;
+    counter->last.process_id = 0;
+    counter->last.start_time = 0;
+    counter->last.end_time = 0;
+    counter->total = 0;
+}
+
+/**
+ * Print gantt chart
+ */
+void print_gantt_chart(GanttEntry gantt[], int gantt_count) {
+    printf("\nGantt Chart:\n");
+    if (gantt_count > 0) {
+        print_gantt_row(stdout, gantt, gantt_count);
+    }
+    printf("\n");
+}
@@ -0,0 +1,94 @@
+#ifndef GANTT_H
+#define GANTT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arena.h"
+
+// Entries a text sink prints per row of the chart
+#define GANTT_TEXT_ROW_ENTRIES 1024
+
+// Entries a file sink buffers before writing them out as one block
+#define GANTT_BLOCK_ENTRIES 4096
+
+// Binary Gantt file identification
+#define GANTT_FILE_MAGIC "GANTTLOG"
+#define GANTT_FILE_VERSION 1
+
+// Gantt chart entry
+typedef struct {
+    int process_id;
+    int start_time;
+    int end_time;
+} GanttEntry;
+
+// Destination for the slices a scheduler runs, reported in time order.
+// Every sink run-length encodes: a slice that continues the previous entry
+// of the same process extends that entry instead of adding a new one.
+typedef struct GanttSink {
+    void (*add)(struct GanttSink *sink, int process_id, int start_time, int end_time);
+    void (*close)(struct GanttSink *sink);
+} GanttSink;
+
+// In-memory sink: growable Gantt chart backed by an arena
+typedef struct {
+    GanttSink sink;
+    GanttEntry *entries;
+    int count;
+    int capacity;
+    Arena *arena;
+} GanttChart;
+
+// Text sink: prints the chart as it fills, one row of entries at a time
+typedef struct {
+    GanttSink sink;
+    FILE *out;
+    GanttEntry row[GANTT_TEXT_ROW_ENTRIES];
+    int count;          // Entries in the current row
+    bool header_printed;
+} GanttTextSink;
+
+// File sink: streams entries to a binary file in fixed-size blocks
+typedef struct {
+    GanttSink sink;
+    FILE *file;
+    GanttEntry block[GANTT_BLOCK_ENTRIES];
+    int count;          // Entries in the current block
+    long long total;    // Entries written or pending
+    bool failed;
+} GanttFileSink;
+
+// Counting sink: keeps the number of entries and the last one, nothing else
+typedef struct {
+    GanttSink sink;
+    GanttEntry last;
+    long long total;
+} GanttCounter;
+
+// Header of a binary Gantt file, followed by `count` GanttEntry records
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t entry_size;
+    uint64_t count;
+} GanttFileHeader;
+
+/**
+ * Report one execution slice to a sink
+ */
+static inline void gantt_add(GanttSink *sink, int process_id, int start_time, int end_time) {
+    sink->add(sink, process_id, start_time, end_time);
+}
+
+// Gantt chart functions
+void gantt_close(GanttSink *sink);
+void gantt_init(GanttChart *gantt, Arena *arena);
+void gantt_clear(GanttChart *gantt);
+void gantt_text_sink_init(GanttTextSink *text, FILE *out);
+bool gantt_file_sink_open(GanttFileSink *file_sink, const char *filename);
+void gantt_counter_init(GanttCounter *counter);
+void print_gantt_chart(GanttEntry gantt[], int gantt_count);
+
+#endif // GANTT_H
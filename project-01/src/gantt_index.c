@@ -0,0 +1,136 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Timeline index builder and query tool
+
+ * Builds a timeline index from a binary Gantt file (written by ./compare -g) and
+ * answers point, range and per-process queries from the mapped index.
+
+ * Usage: ./gantt_index build timeline.gantt [index.gidx]
+ *        ./gantt_index at index.gidx time
+ *        ./gantt_index range index.gidx from to
+ *        ./gantt_index pid index.gidx pid
+ * Output: matching Gantt entries and the query time
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "timeline.h"
+
+/**
+ * Monotonic clock in microseconds
+ */
+static double now_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1e6 + now.tv_nsec / 1e3;
+}
+
+/**
+ * Print usage
+ */
+static void print_usage(const char *program) {
+    printf("Usage: %s build timeline.gantt [index.gidx]\n", program);
+    printf("       %s at index.gidx time\n", program);
+    printf("       %s range index.gidx from to\n", program);
+    printf("       %s pid index.gidx pid\n", program);
+}
+
+/**
+ * Build an index next to the Gantt file (.gantt replaced by .gidx) unless a name is given
+ */
+static int build_index(const char *gantt_filename, const char *index_filename) {
+    char default_name[4096];
+    if (index_filename == NULL) {
+        size_t length = strlen(gantt_filename);
+        if (length > 6 && strcmp(gantt_filename + length - 6, ".gantt") == 0) length -= 6;
+        snprintf(default_name, sizeof(default_name), "%.*s.gidx", (int)length, gantt_filename);
+        index_filename = default_name;
+    }
+
+    GanttFileView view;
+    if (!gantt_file_map(gantt_filename, &view)) return 1;
+
+    Arena arena;
+    TimelineIndex index;
+    arena_init(&arena);
+    bool ok = timeline_build(&index, view.entries, view.count, &arena) &&
+              timeline_write(index_filename, &index);
+    if (ok) {
+        printf("Indexed %llu entries of %llu processes from '%s' into '%s'\n",
+               (unsigned long long)index.count, (unsigned long long)index.num_pids,
+               gantt_filename, index_filename);
+    }
+
+    arena_free(&arena);
+    gantt_file_unmap(&view);
+    return ok ? 0 : 1;
+}
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    if (argc >= 3 && argc <= 4 && strcmp(argv[1], "build") == 0) {
+        return build_index(argv[2], (argc == 4) ? argv[3] : NULL);
+    }
+
+    bool at = argc == 4 && strcmp(argv[1], "at") == 0;
+    bool range = argc == 5 && strcmp(argv[1], "range") == 0;
+    bool pid = argc == 4 && strcmp(argv[1], "pid") == 0;
+    if (!at && !range && !pid) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    TimelineIndex index;
+    if (!timeline_open(argv[2], &index)) return 1;
+
+    double start = now_us();
+    if (at) {
+        int time = atoi(argv[3]);
+        int64_t i = timeline_at(&index, time);
+        double elapsed = now_us() - start;
+
+        if (i < 0) {
+            printf("t=%d: idle\n", time);
+        } else {
+            printf("t=%d: P%d (%d-%d)\n", time, index.process_id[i], index.start_time[i], index.end_time[i]);
+        }
+        printf("Query time: %.2f us\n", elapsed);
+    } else if (range) {
+        int from = atoi(argv[3]);
+        int to = atoi(argv[4]);
+        uint64_t first;
+        uint64_t count = timeline_range(&index, from, to, &first);
+        double elapsed = now_us() - start;
+
+        printf("%llu entries overlap [%d, %d):\n", (unsigned long long)count, from, to);
+        for (uint64_t i = first; i < first + count; i++) {
+            printf("P%d\t%d-%d\n", index.process_id[i], index.start_time[i], index.end_time[i]);
+        }
+        printf("Query time: %.2f us\n", elapsed);
+    } else {
+        int process_id = atoi(argv[3]);
+        const uint32_t *slices;
+        uint64_t count = timeline_pid_slices(&index, process_id, &slices);
+        double elapsed = now_us() - start;
+
+        long long cpu_time = 0;
+        printf("P%d ran %llu slices:\n", process_id, (unsigned long long)count);
+        for (uint64_t s = 0; s < count; s++) {
+            uint32_t i = slices[s];
+            printf("%d-%d\n", index.start_time[i], index.end_time[i]);
+            cpu_time += index.end_time[i] - index.start_time[i];
+        }
+        printf("CPU time: %lld\n", cpu_time);
+        printf("Query time: %.2f us\n", elapsed);
+    }
+
+    timeline_close(&index);
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Streaming log-linear histogram (HDR style)
+
+ * Each power of two is split into HISTOGRAM_SUB_BUCKETS / 2 equal buckets, so a value
+ * is stored with a bounded relative error in a fixed-size array. Recording is O(1),
+ * percentiles are one pass over the buckets, and two histograms merge by adding counts,
+ * so per-thread or per-run histograms can be combined without keeping any samples.
+ */
+
+#include <string.h>
+#include "histogram.h"
+
+/**
+ * Bucket holding a value
+ */
+static int bucket_index(uint64_t value) {
+    if (value < HISTOGRAM_SUB_BUCKETS) return (int)value;
+
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - HISTOGRAM_SUB_BUCKET_BITS + 1;
+    int mantissa = (int)(value >> shift); // In [SUB_BUCKETS / 2, SUB_BUCKETS)
+    return HISTOGRAM_SUB_BUCKETS + (shift - 1) * (HISTOGRAM_SUB_BUCKETS / 2) +
+           (mantissa - HISTOGRAM_SUB_BUCKETS / 2);
+}
+
+/**
+ * Largest value that falls in a bucket
+ */
+static uint64_t bucket_highest_value(int index) {
+    if (index < HISTOGRAM_SUB_BUCKETS) return (uint64_t)index;
+
+    int group = (index - HISTOGRAM_SUB_BUCKETS) / (HISTOGRAM_SUB_BUCKETS / 2);
+    int mantissa = (index - HISTOGRAM_SUB_BUCKETS) % (HISTOGRAM_SUB_BUCKETS / 2) + HISTOGRAM_SUB_BUCKETS / 2;
+    int shift = group + 1;
+    return (((uint64_t)mantissa + 1) << shift) - 1;
+}
+
+/**
+ * Initialize an empty histogram
+ */
+void histogram_init(Histogram *histogram) {
+    memset(histogram->counts, 0, sizeof(histogram->counts));
+    histogram->total_count = 0;
+    histogram->sum = 0;
+    histogram->min = 0;
+    histogram->max = 0;
+}
+
+/**
+ * Record one value (negative values are recorded as 0)
+ */
+void histogram_record(Histogram *histogram, long long value) {
+    if (value < 0) value = 0;
+
+    histogram->counts[bucket_index((uint64_t)value)]++;
+    if (histogram->total_count == 0 || value < histogram->min) histogram->min = value;
+    if (histogram->total_count == 0 || value > histogram->max) histogram->max = value;
+    histogram->total_count++;
+    histogram->sum += value;
+}
+
+/**
+ * Add the samples of one histogram to another
+ */
+void histogram_merge(Histogram *into, const Histogram *from) {
+    if (from->total_count == 0) return;
+
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        into->counts[i] += from->counts[i];
+    }
+    if (into->total_count == 0 || from->min < into->min) into->min = from->min;
+    if (into->total_count == 0 || from->max > into->max) into->max = from->max;
+    into->total_count += from->total_count;
+    into->sum += from->sum;
+}
+
+/**
+ * Value at a percentile (0-100), reported as the top of its bucket and never above the maximum
+ */
+long long histogram_percentile(const Histogram *histogram, double percentile) {
+    if (histogram->total_count == 0) return 0;
+    if (percentile >= 100.0) return histogram->max;
+
+    // Nearest rank: the smallest sample with at least this share of samples at or below it
+    double exact_rank = percentile / 100.0 * (double)histogram->total_count;
+    uint64_t rank = (uint64_t)exact_rank;
+    if ((double)rank < exact_rank) rank++;
+    if (rank < 1) rank = 1;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += histogram->counts[i];
+        if (seen >= rank) {
+            uint64_t value = bucket_highest_value(i);
+            return (value > (uint64_t)histogram->max) ? histogram->max : (long long)value;
+        }
+    }
+    return histogram->max;
+}
+
+/**
+ * Mean of the recorded values (exact, from the 64-bit sum)
+ */
+double histogram_mean(const Histogram *histogram) {
+    return (histogram->total_count > 0) ? (double)histogram->sum / histogram->total_count : 0.0;
+}
@@ -0,0 +1,28 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+// Log-linear buckets: values below HISTOGRAM_SUB_BUCKETS are exact, larger values keep
+// their top HISTOGRAM_SUB_BUCKET_BITS bits (relative error below 1.6%)
+#define HISTOGRAM_SUB_BUCKET_BITS 7
+#define HISTOGRAM_SUB_BUCKETS (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_BUCKETS (HISTOGRAM_SUB_BUCKETS + (64 - HISTOGRAM_SUB_BUCKET_BITS) * (HISTOGRAM_SUB_BUCKETS / 2))
+
+// Constant-memory streaming histogram of non-negative values
+typedef struct {
+    uint64_t counts[HISTOGRAM_BUCKETS];
+    uint64_t total_count;
+    long long sum;
+    long long min;
+    long long max;
+} Histogram;
+
+// Histogram functions
+void histogram_init(Histogram *histogram);
+void histogram_record(Histogram *histogram, long long value);
+void histogram_merge(Histogram *into, const Histogram *from);
+long long histogram_percentile(const Histogram *histogram, double percentile);
+double histogram_mean(const Histogram *histogram);
+
+#endif // HISTOGRAM_H
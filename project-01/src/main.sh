@@ -6,7 +6,7 @@ compile_programs() {
     echo "Compiling programs..."
     
     # Compile SJF
-    if gcc -o sjf_1 sjf_1.c -Wall -Wextra; then
+    if gcc -o sjf_1 sjf_main.c sjf_1.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
         echo "SJF compiled successfully"
     else
         echo "SJF compilation failed"
@@ -14,13 +14,85 @@ compile_programs() {
     fi
     
     # Compile Round Robin
-    if gcc -o round_robin round_robin.c -Wall -Wextra; then
+    if gcc -o round_robin round_robin_main.c round_robin.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
         echo "Round Robin compiled successfully"
     else
         echo "Round Robin compilation failed"
         return 1
     fi
     
+    # Compile SRTF
+    if gcc -o srtf srtf_main.c srtf.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "SRTF compiled successfully"
+    else
+        echo "SRTF compilation failed"
+        return 1
+    fi
+    
+    # Compile Priority
+    if gcc -o priority priority_main.c priority.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "Priority compiled successfully"
+    else
+        echo "Priority compilation failed"
+        return 1
+    fi
+    
+    # Compile MLFQ
+    if gcc -o mlfq mlfq_main.c mlfq.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "MLFQ compiled successfully"
+    else
+        echo "MLFQ compilation failed"
+        return 1
+    fi
+    
+    # Compile SMP
+    if gcc -o smp smp_main.c smp.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "SMP compiled successfully"
+    else
+        echo "SMP compilation failed"
+        return 1
+    fi
+    
+    # Compile parameter sweep
+    if gcc -o sweep sweep.c sjf_1.c round_robin.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "Parameter sweep compiled successfully"
+    else
+        echo "Parameter sweep compilation failed"
+        return 1
+    fi
+    
+    # Compile comparison driver
+    if gcc -o compare compare.c sjf_1.c round_robin.c srtf.c priority.c mlfq.c smp.c simulation.c gantt.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread; then
+        echo "Comparison driver compiled successfully"
+    else
+        echo "Comparison driver compilation failed"
+        return 1
+    fi
+    
+    # Compile trace converter
+    if gcc -o trace_convert trace_convert.c trace.c arena.c -Wall -Wextra -pthread; then
+        echo "Trace converter compiled successfully"
+    else
+        echo "Trace converter compilation failed"
+        return 1
+    fi
+    
+    # Compile workload generator
+    if gcc -o workload_gen workload_gen.c workload.c process.c histogram.c memory_manager.c arena.c trace.c -Wall -Wextra -pthread -lm; then
+        echo "Workload generator compiled successfully"
+    else
+        echo "Workload generator compilation failed"
+        return 1
+    fi
+    
+    # Compile timeline index tool
+    if gcc -o gantt_index gantt_index.c timeline.c gantt.c arena.c -Wall -Wextra -pthread; then
+        echo "Timeline index tool compiled successfully"
+    else
+        echo "Timeline index tool compilation failed"
+        return 1
+    fi
+    
     echo
     return 0
 }
@@ -61,6 +133,71 @@ run_round_robin() {
     echo
 }
 
+# Function to run SRTF only
+run_srtf() {
+    echo "---Running Shortest Remaining Time First (SRTF) Scheduler---"
+    echo
+    
+    if ! check_processes_file; then
+        return 1
+    fi
+    
+    ./srtf | tee -a "$OUTPUT_FILE"
+    echo
+}
+
+# Function to run Priority only
+run_priority() {
+    echo "---Running Priority Scheduler---"
+    echo
+    
+    if ! check_processes_file; then
+        return 1
+    fi
+    
+    ./priority | tee -a "$OUTPUT_FILE"
+    echo
+}
+
+# Function to run MLFQ only
+run_mlfq() {
+    echo "---Running MLFQ Scheduler---"
+    echo
+    
+    if ! check_processes_file; then
+        return 1
+    fi
+    
+    ./mlfq | tee -a "$OUTPUT_FILE"
+    echo
+}
+
+# Function to run SMP only
+run_smp() {
+    echo "---Running SMP Scheduler---"
+    echo
+    
+    if ! check_processes_file; then
+        return 1
+    fi
+    
+    ./smp | tee -a "$OUTPUT_FILE"
+    echo
+}
+
+# Function to run a parameter sweep
+run_sweep() {
+    echo "---Running Parameter Sweep---"
+    echo
+    
+    if ! check_processes_file; then
+        return 1
+    fi
+    
+    ./sweep -q 1-6 -m 512,1024,2048 -p 32,64,128 -o sweep_results.csv | tee -a "$OUTPUT_FILE"
+    echo
+}
+
 # Function to run comparison
 run_comparison() {
     echo "---Running Algorithm Comparison---"
@@ -76,49 +213,20 @@ run_comparison() {
     echo "---Algorithm Comparison---" | tee -a "$OUTPUT_FILE"
     echo | tee -a "$OUTPUT_FILE"
     
-    # Run Round Robin
-    echo "Round Robin Scheduler:" | tee -a "$OUTPUT_FILE"
-    rr_output=$(./round_robin)
-    echo "$rr_output" | tee -a "$OUTPUT_FILE"
-    echo | tee -a "$OUTPUT_FILE"
-    
-    # Run SJF
-    echo "Shortest Job First (SJF) Scheduler:" | tee -a "$OUTPUT_FILE"
-    sjf_output=$(./sjf_1)
-    echo "$sjf_output" | tee -a "$OUTPUT_FILE"
-    echo | tee -a "$OUTPUT_FILE"
-    
-    #  metrics for comparison
-    echo "---Performance Comparison---" | tee -a "$OUTPUT_FILE"
-    echo | tee -a "$OUTPUT_FILE"
-    
-    #  average waiting times
-    rr_wait_time=$(echo "$rr_output" | grep -i "average waiting time" | head -1 | awk '{print $NF}')
-    sjf_wait_time=$(echo "$sjf_output" | grep -i "average waiting time" | head -1 | awk '{print $NF}')
-    
-    # average turnaround times
-    rr_turnaround_time=$(echo "$rr_output" | grep -i "average turnaround time" | head -1 | awk '{print $NF}')
-    sjf_turnaround_time=$(echo "$sjf_output" | grep -i "average turnaround time" | head -1 | awk '{print $NF}')
-    
-    # Display comparison results
-    echo "Average Waiting Times:" | tee -a "$OUTPUT_FILE"
-    echo "Round Robin: $rr_wait_time" | tee -a "$OUTPUT_FILE"
-    echo "SJF:         $sjf_wait_time" | tee -a "$OUTPUT_FILE"
+    # One run loads the trace once and schedules every algorithm concurrently
+    if ! comparison=$(./compare); then
+        echo "$comparison" | tee -a "$OUTPUT_FILE"
+        echo "Error: Comparison run failed." | tee -a "$OUTPUT_FILE"
+        return 1
+    fi
+    echo "$comparison" | tee -a "$OUTPUT_FILE"
     echo | tee -a "$OUTPUT_FILE"
     
-    echo "Average Turnaround Times:" | tee -a "$OUTPUT_FILE"
-    echo "Round Robin: $rr_turnaround_time" | tee -a "$OUTPUT_FILE"
-    echo "SJF:         $sjf_turnaround_time" | tee -a "$OUTPUT_FILE"
-    echo | tee -a "$OUTPUT_FILE"
+    # Columns: algorithm,processes,average_waiting,average_turnaround,max_waiting,makespan,dispatches
+    result=$(echo "$comparison" | awk -F, 'NR > 1 && (best == "" || $3 < best_wait) { best = $1; best_wait = $3 }
+        END { if (best != "") print best " has the lowest average wait time (" best_wait ")" }')
     
-    # Determine which scheduler performs better
-    if [ -n "$rr_wait_time" ] && [ -n "$sjf_wait_time" ]; then
-        result=$(awk -v rr="$rr_wait_time" -v sjf="$sjf_wait_time" 'BEGIN {
-            if (rr < sjf) print "Round Robin has lower average wait time";
-            else if (rr > sjf) print "SJF has lower average wait time";
-            else print "Both have the same average wait time";
-        }')
-        
+    if [ -n "$result" ]; then
         echo "Conclusion: $result" | tee -a "$OUTPUT_FILE"
     else
         echo "Error: Could not extract wait times for comparison." | tee -a "$OUTPUT_FILE"
@@ -134,12 +242,17 @@ display_menu() {
     echo "Please select an option:"
     echo "1. Run Shortest Job First (SJF) Scheduler"
     echo "2. Run Round Robin Scheduler"
-    echo "3. Run Algorithm Comparison"
-    echo "4. View Output File"
-    echo "5. Clean Up (Remove executables)"
-    echo "6. Exit"
+    echo "3. Run Shortest Remaining Time First (SRTF) Scheduler"
+    echo "4. Run Priority Scheduler (with aging)"
+    echo "5. Run Multi-Level Feedback Queue (MLFQ) Scheduler"
+    echo "6. Run Multi-CPU (SMP) Round Robin Scheduler"
+    echo "7. Run Parameter Sweep (quantum, memory and page sizes)"
+    echo "8. Run Algorithm Comparison"
+    echo "9. View Output File"
+    echo "10. Clean Up (Remove executables)"
+    echo "11. Exit"
     echo
-    echo -n "Enter your choice [1-6]: "
+    echo -n "Enter your choice [1-11]: "
 }
 
 # Function to view output file
@@ -157,7 +270,7 @@ view_output() {
 # Function to clean up
 cleanup() {
     echo "Cleaning up executables..."
-    rm -f sjf_1 round_robin
+    rm -f sjf_1 round_robin srtf priority mlfq smp sweep compare trace_convert workload_gen gantt_index
     echo "Cleanup completed!"
     echo
 }
@@ -196,24 +309,44 @@ main() {
                 pause
                 ;;
             3)
-                run_comparison
+                run_srtf
                 pause
                 ;;
             4)
-                view_output
+                run_priority
                 pause
                 ;;
             5)
-                cleanup
+                run_mlfq
                 pause
                 ;;
             6)
+                run_smp
+                pause
+                ;;
+            7)
+                run_sweep
+                pause
+                ;;
+            8)
+                run_comparison
+                pause
+                ;;
+            9)
+                view_output
+                pause
+                ;;
+            10)
+                cleanup
+                pause
+                ;;
+            11)
                 echo "Thank you for using the CPU Scheduling Simulator!"
                 cleanup
                 exit 0
                 ;;
             *)
-                echo "Invalid choice. Please enter a number between 1 and 6."
+                echo "Invalid choice. Please enter a number between 1 and 11."
                 echo
                 pause
                 ;;
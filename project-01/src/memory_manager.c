@@ -0,0 +1,1157 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Memory management shared by the schedulers
+
+ * Contiguous allocation (first-fit, best-fit, worst-fit) over a linked list of blocks,
+ * and paging with FIFO or LRU page replacement.
+ * The free blocks are also kept in a treap ordered by (size, address), so best-fit
+ * is a lower-bound search and worst-fit a maximum search, both O(log n) in the number
+ * of blocks. Ties still go to the lowest address, as in the list walk.
+ * Block nodes come from a slab pool owned by the manager, so splits and merges recycle
+ * nodes in O(1) without malloc/free, and a reset between runs rewinds the pool at once.
+ * TLSF keeps the free blocks in size-class lists instead of the tree: a first-level
+ * bitmap per power of two and a second-level bitmap per linear subdivision find a
+ * large enough class with find-first-set, so allocation and free are O(1) however
+ * many blocks there are. Only one of the two indexes holds the free blocks at a time.
+ * Free page frames are tracked in a hierarchical bitmap, so the lowest free frame is
+ * found with a few count-trailing-zeros whatever the frame count, and all the free
+ * frames a process needs are taken in one pass.
+ * Addresses and sizes are 64-bit. Frame metadata lives in packed columns in one mapping
+ * made at init, so hosts with hundreds of GB of small pages fit in a few GB.
+ * BUDDY instead hands out power-of-two blocks from per-order free lists. A bitmap
+ * records which blocks are free at each order, so a freed block finds a free buddy
+ * with one bit test and allocation and free are O(log memory size).
+ * Each algorithm gets its own copy of the search: the generic bodies are always
+ * inlined into one small wrapper per algorithm with the algorithm as a constant, so
+ * the algorithm tests fold away. Callers pick a wrapper once
+ * through a dispatch table (contiguous_allocator, page_allocator) instead of passing
+ * the enum down on every call.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include "memory_manager.h"
+
+/**
+ * Parse a size in bytes with an optional K, M, G or T suffix (powers of 1024)
+ * Sets end past the size when it is not NULL. Returns -1 if there is no size.
+ */
+long long parse_memory_size(const char *text, char **end) {
+    char *suffix;
+    long long size = strtoll(text, &suffix, 10);
+    int shift = 0;
+
+    if (suffix == text || size < 0) return -1;
+    switch (*suffix) {
+        case 'K': case 'k': shift = 10; break;
+        case 'M': case 'm': shift = 20; break;
+        case 'G': case 'g': shift = 30; break;
+        case 'T': case 't': shift = 40; break;
+        default: break;
+    }
+    if (shift > 0) {
+        suffix++;
+        if (size > (LLONG_MAX >> 2) >> shift) return -1;
+        size <<= shift;
+    }
+    if (end != NULL) *end = suffix;
+    return size;
+}
+
+/**
+ * Check that a memory configuration holds at least one page frame, and no more frames
+ * than an int can index
+ */
+bool check_memory_config(long long memory_size, long long page_size) {
+    if (page_size <= 0 || page_size > INT_MAX || memory_size < page_size || memory_size / page_size > INT_MAX) {
+        printf("Error: Invalid memory configuration (memory size %lld, page size %lld)\n", memory_size, page_size);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Take a block node from the pool: a recycled node if there is one, else the next
+ * node of the current slab (slabs kept from before a reset are reused first)
+ */
+static MemoryBlock *block_pool_take(MemoryBlockPool *pool) {
+    MemoryBlock *block = pool->free_list;
+
+    if (block != NULL) {
+        pool->free_list = block->next;
+        pool->recycled++;
+    } else {
+        if (pool->current == NULL || pool->carved == MEMORY_BLOCK_SLAB_BLOCKS) {
+            MemoryBlockSlab *slab = (pool->current != NULL) ? pool->current->next : pool->slabs;
+            if (slab == NULL) {
+                slab = (MemoryBlockSlab *)malloc(sizeof(MemoryBlockSlab));
+                slab->next = NULL;
+                if (pool->current != NULL) {
+                    pool->current->next = slab;
+                } else {
+                    pool->slabs = slab;
+                }
+                pool->num_slabs++;
+            }
+            pool->current = slab;
+            pool->carved = 0;
+        }
+        block = &pool->current->blocks[pool->carved++];
+    }
+
+    pool->taken++;
+    if (++pool->in_use > pool->peak_in_use) {
+        pool->peak_in_use = pool->in_use;
+    }
+    return block;
+}
+
+/**
+ * Return a block node to the pool
+ */
+static void block_pool_give(MemoryBlockPool *pool, MemoryBlock *block) {
+    block->next = pool->free_list;
+    pool->free_list = block;
+    pool->in_use--;
+}
+
+/**
+ * Size the buddy system for memory_size bytes and allocate its per-unit arrays
+ */
+static void buddy_init(BuddyAllocator *buddy, long long memory_size) {
+    buddy->unit_shift = BUDDY_MIN_SHIFT;
+    while ((memory_size >> buddy->unit_shift) > BUDDY_MAX_UNITS) {
+        buddy->unit_shift++;
+    }
+    buddy->num_units = (int)(memory_size >> buddy->unit_shift);
+    buddy->max_order = -1;
+    while (buddy->max_order + 1 < BUDDY_MAX_ORDERS && (1 << (buddy->max_order + 1)) <= buddy->num_units) {
+        buddy->max_order++;
+    }
+
+    // Order k has num_units >> k whole blocks, each with one bit
+    int bits = 0;
+    for (int k = 0; k <= buddy->max_order; k++) {
+        buddy->bit_offset[k] = bits;
+        bits += buddy->num_units >> k;
+    }
+
+    int units = (buddy->num_units > 0) ? buddy->num_units : 1;
+    buddy->next_free = (int *)malloc(units * sizeof(int));
+    buddy->prev_free = (int *)malloc(units * sizeof(int));
+    buddy->order = (signed char *)malloc(units * sizeof(signed char));
+    buddy->process_id = (int *)malloc(units * sizeof(int));
+    buddy->free_bits = (unsigned long long *)malloc(((bits + 63) / 64 + 1) * sizeof(unsigned long long));
+}
+
+/**
+ * Size the free-frame bitmap for num_frames frames
+ * Returns the words needed by all levels together, to be passed to frame_bitmap_place.
+ */
+static size_t frame_bitmap_size(FrameBitmap *bitmap, int num_frames) {
+    size_t total = 0;
+    int words = (num_frames + 63) / 64;
+
+    bitmap->num_levels = 0;
+    while (true) {
+        bitmap->num_words[bitmap->num_levels++] = words;
+        total += words;
+        if (words == 1) break;
+        words = (words + 63) / 64;
+    }
+    return total;
+}
+
+/**
+ * Lay the bitmap levels out one after another in storage
+ */
+static void frame_bitmap_place(FrameBitmap *bitmap, unsigned long long *storage) {
+    bitmap->words[0] = storage;
+    for (int level = 1; level < bitmap->num_levels; level++) {
+        bitmap->words[level] = bitmap->words[level - 1] + bitmap->num_words[level - 1];
+    }
+}
+
+/**
+ * Mark every one of num_frames frames free
+ */
+static void frame_bitmap_fill(FrameBitmap *bitmap, int num_frames) {
+    int count = num_frames;
+
+    // Each level has count set bits: one per frame, then one per word of the level below
+    for (int level = 0; level < bitmap->num_levels; level++) {
+        unsigned long long *words = bitmap->words[level];
+        for (int w = 0; w < bitmap->num_words[level]; w++) {
+            int bits = count - w * 64;
+            words[w] = (bits >= 64) ? ~0ULL : (1ULL << bits) - 1;
+        }
+        count = bitmap->num_words[level];
+    }
+    bitmap->free_count = num_frames;
+}
+
+/**
+ * Mark a frame free, setting the summary bits of words that were empty
+ */
+static void frame_bitmap_set(FrameBitmap *bitmap, int frame) {
+    unsigned long long *word = &bitmap->words[0][frame / 64];
+    unsigned long long bit = 1ULL << (frame % 64);
+    if (*word & bit) return;
+
+    bitmap->free_count++;
+    for (int level = 0, index = frame; level < bitmap->num_levels; level++, index /= 64) {
+        word = &bitmap->words[level][index / 64];
+        bool was_empty = (*word == 0);
+        *word |= 1ULL << (index % 64);
+        if (!was_empty) break;
+    }
+}
+
+/**
+ * Clear bit index of a level, and the summary bits of words that became empty
+ */
+static void frame_bitmap_clear_from(FrameBitmap *bitmap, int level, int index) {
+    for (; level < bitmap->num_levels; level++, index /= 64) {
+        unsigned long long *word = &bitmap->words[level][index / 64];
+        *word &= ~(1ULL << (index % 64));
+        if (*word != 0) break;
+    }
+}
+
+/**
+ * Take up to count free frames, lowest first, into frames
+ * Each level-0 word with a free frame is found with one ctz per level above it, and then
+ * gives up all the frames it can before its summary bits are updated once.
+ * Returns the number of frames taken.
+ */
+static int frame_bitmap_take(FrameBitmap *bitmap, int frames[], int count) {
+    int top = bitmap->num_levels - 1;
+    int taken = 0;
+
+    while (taken < count && bitmap->words[top][0] != 0) {
+        int w = 0;
+        for (int level = top; level > 0; level--) {
+            w = w * 64 + __builtin_ctzll(bitmap->words[level][w]);
+        }
+
+        unsigned long long bits = bitmap->words[0][w];
+        while (bits != 0 && taken < count) {
+            frames[taken++] = w * 64 + __builtin_ctzll(bits);
+            bits &= bits - 1;
+        }
+        bitmap->words[0][w] = bits;
+        if (bits == 0 && top > 0) {
+            frame_bitmap_clear_from(bitmap, 1, w);
+        }
+    }
+
+    bitmap->free_count -= taken;
+    return taken;
+}
+
+/**
+ * Map the frame columns, FIFO queue and free-frame bitmap as one anonymous region
+ * The kernel only backs the pages that get touched, and with 14 bytes per frame
+ * 10^8 frames take about 1.4 GB.
+ */
+static void map_frame_storage(MemoryManager *mm) {
+    size_t frames = (size_t)mm->num_pages;
+    size_t bitmap_bytes = frame_bitmap_size(&mm->free_frames, mm->num_pages) * sizeof(unsigned long long);
+    size_t int_bytes = frames * sizeof(int);
+
+    // Widest fields first, so every column stays aligned
+    mm->frame_storage_bytes = bitmap_bytes + 3 * int_bytes + frames * sizeof(unsigned short);
+    mm->frame_storage = mmap(NULL, mm->frame_storage_bytes, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mm->frame_storage == MAP_FAILED) {
+        printf("Error: Could not map %zu bytes for %d page frames\n", mm->frame_storage_bytes, mm->num_pages);
+        exit(1);
+    }
+
+    char *cursor = (char *)mm->frame_storage;
+    frame_bitmap_place(&mm->free_frames, (unsigned long long *)cursor);
+    cursor += bitmap_bytes;
+    mm->page_frames.process_id = (int *)cursor;
+    cursor += int_bytes;
+    mm->page_frames.last_access_time = (int *)cursor;
+    cursor += int_bytes;
+    mm->fifo_queue = (int *)cursor;
+    cursor += int_bytes;
+    mm->page_frames.page_number = (unsigned short *)cursor;
+}
+
+/**
+ * Initialize memory manager with memory_size bytes split into page_size byte frames
+ * The sizes must have passed check_memory_config.
+ */
+void init_memory_manager(MemoryManager *mm, long long memory_size, int page_size) {
+    mm->memory_size = memory_size;
+    mm->page_size = page_size;
+    mm->num_pages = (int)(memory_size / page_size);
+
+    map_frame_storage(mm);
+    memset(&mm->block_pool, 0, sizeof(mm->block_pool));
+    memset(&mm->tlsf, 0, sizeof(mm->tlsf));
+    mm->tlsf_indexed = false;
+    buddy_init(&mm->buddy, memory_size);
+    mm->print_warnings = true;
+
+    reset_memory_manager(mm);
+}
+
+/**
+ * Bit of the block of an order that starts at unit
+ */
+static inline int buddy_bit(const BuddyAllocator *buddy, int order, int unit) {
+    return buddy->bit_offset[order] + (unit >> order);
+}
+
+/**
+ * Whether the block of an order starting at unit is free at exactly that order
+ */
+static inline bool buddy_is_free(const BuddyAllocator *buddy, int order, int unit) {
+    int bit = buddy_bit(buddy, order, unit);
+    return (buddy->free_bits[bit / 64] >> (bit % 64)) & 1;
+}
+
+/**
+ * Add a free block to the free list of its order
+ */
+static void buddy_push(BuddyAllocator *buddy, int order, int unit) {
+    int bit = buddy_bit(buddy, order, unit);
+    int head = buddy->free_head[order];
+
+    buddy->free_bits[bit / 64] |= 1ULL << (bit % 64);
+    buddy->order[unit] = (signed char)order;
+    buddy->next_free[unit] = head;
+    buddy->prev_free[unit] = -1;
+    if (head != -1) {
+        buddy->prev_free[head] = unit;
+    }
+    buddy->free_head[order] = unit;
+    buddy->free_count[order]++;
+    buddy->nonempty |= 1u << order;
+}
+
+/**
+ * Take a free block off the free list of its order
+ */
+static void buddy_remove(BuddyAllocator *buddy, int order, int unit) {
+    int bit = buddy_bit(buddy, order, unit);
+    int next = buddy->next_free[unit];
+    int prev = buddy->prev_free[unit];
+
+    buddy->free_bits[bit / 64] &= ~(1ULL << (bit % 64));
+    if (prev != -1) {
+        buddy->next_free[prev] = next;
+    } else {
+        buddy->free_head[order] = next;
+    }
+    if (next != -1) {
+        buddy->prev_free[next] = prev;
+    }
+    if (--buddy->free_count[order] == 0) {
+        buddy->nonempty &= ~(1u << order);
+    }
+}
+
+/**
+ * Free all buddy blocks: memory becomes the largest aligned power-of-two blocks that fit
+ */
+static void buddy_reset(BuddyAllocator *buddy) {
+    int bits = (buddy->max_order >= 0) ? buddy->bit_offset[buddy->max_order] + (buddy->num_units >> buddy->max_order) : 0;
+    memset(buddy->free_bits, 0, ((bits + 63) / 64 + 1) * sizeof(unsigned long long));
+    for (int k = 0; k < BUDDY_MAX_ORDERS; k++) {
+        buddy->free_head[k] = -1;
+        buddy->free_count[k] = 0;
+    }
+    buddy->nonempty = 0;
+
+    int unit = 0;
+    while (unit < buddy->num_units) {
+        int order = buddy->max_order;
+        while ((unit & ((1 << order) - 1)) != 0 || unit + (1 << order) > buddy->num_units) {
+            order--;
+        }
+        buddy_push(buddy, order, unit);
+        unit += 1 << order;
+    }
+
+    buddy->live_blocks = 0;
+    buddy->requested_bytes = 0;
+    buddy->allocated_bytes = 0;
+    buddy->peak_internal = 0;
+    buddy->allocations = 0;
+}
+
+/**
+ * Free all memory and clear the statistics, keeping the configuration
+ * Every block node goes back to the pool in one step, so a manager can be reused for
+ * the next run without freeing and reallocating anything.
+ */
+void reset_memory_manager(MemoryManager *mm) {
+    MemoryBlockPool *pool = &mm->block_pool;
+    pool->current = NULL;
+    pool->carved = 0;
+    pool->free_list = NULL;
+    pool->in_use = 0;
+    pool->peak_in_use = 0;
+    pool->taken = 0;
+    pool->recycled = 0;
+
+    // Initialize contiguous memory as one large free block
+    mm->memory_blocks = block_pool_take(pool);
+    mm->memory_blocks->start_address = 0;
+    mm->memory_blocks->size = mm->memory_size;
+    mm->memory_blocks->process_id = -1; // Free
+    mm->memory_blocks->next = NULL;
+    mm->memory_blocks->prev = NULL;
+    mm->memory_blocks->smaller = NULL;
+    mm->memory_blocks->larger = NULL;
+    mm->free_tree = mm->memory_blocks;
+    if (mm->tlsf_indexed) {
+        memset(&mm->tlsf, 0, sizeof(mm->tlsf));
+        mm->tlsf_indexed = false;
+    }
+
+    buddy_reset(&mm->buddy);
+
+    // Initialize page frames
+    memset(mm->page_frames.process_id, 0xff, (size_t)mm->num_pages * sizeof(int)); // All -1
+    memset(mm->page_frames.last_access_time, 0, (size_t)mm->num_pages * sizeof(int));
+    memset(mm->page_frames.page_number, 0, (size_t)mm->num_pages * sizeof(unsigned short));
+    frame_bitmap_fill(&mm->free_frames, mm->num_pages);
+
+    // Initialize FIFO queue
+    mm->fifo_front = 0;
+    mm->fifo_rear = 0;
+    mm->current_time = 0;
+
+    mm->failed_allocations = 0;
+    mm->page_replacements = 0;
+}
+
+/**
+ * Cleanup memory manager
+ */
+void cleanup_memory_manager(MemoryManager *mm) {
+    MemoryBlockSlab *slab = mm->block_pool.slabs;
+    while (slab != NULL) {
+        MemoryBlockSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    mm->block_pool.slabs = NULL;
+    free(mm->buddy.next_free);
+    free(mm->buddy.prev_free);
+    free(mm->buddy.order);
+    free(mm->buddy.process_id);
+    free(mm->buddy.free_bits);
+    munmap(mm->frame_storage, mm->frame_storage_bytes);
+    mm->frame_storage = NULL;
+}
+
+/**
+ * Free-tree ordering: smaller size first, then lower address
+ */
+static bool free_block_before(const MemoryBlock *a, const MemoryBlock *b) {
+    if (a->size != b->size) return a->size < b->size;
+    return a->start_address < b->start_address;
+}
+
+/**
+ * Treap priority: a hash of the address, so the tree shape is random but reproducible
+ */
+static unsigned int free_block_priority(const MemoryBlock *block) {
+    unsigned int x = (unsigned int)(block->start_address ^ (block->start_address >> 32)) * 0x9E3779B1u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x;
+}
+
+/**
+ * Split a subtree into the blocks ordered before key and the rest
+ */
+static void free_tree_split(MemoryBlock *root, const MemoryBlock *key, MemoryBlock **smaller, MemoryBlock **larger) {
+    if (root == NULL) {
+        *smaller = NULL;
+        *larger = NULL;
+    } else if (free_block_before(root, key)) {
+        *smaller = root;
+        free_tree_split(root->larger, key, &root->larger, larger);
+    } else {
+        *larger = root;
+        free_tree_split(root->smaller, key, smaller, &root->smaller);
+    }
+}
+
+/**
+ * Join two subtrees where every block of smaller is ordered before every block of larger
+ */
+static MemoryBlock *free_tree_join(MemoryBlock *smaller, MemoryBlock *larger) {
+    if (smaller == NULL) return larger;
+    if (larger == NULL) return smaller;
+    if (free_block_priority(smaller) > free_block_priority(larger)) {
+        smaller->larger = free_tree_join(smaller->larger, larger);
+        return smaller;
+    }
+    larger->smaller = free_tree_join(smaller, larger->smaller);
+    return larger;
+}
+
+/**
+ * Add a free block to a subtree, returns the new subtree root
+ */
+static MemoryBlock *free_tree_insert(MemoryBlock *root, MemoryBlock *block) {
+    if (root == NULL || free_block_priority(block) > free_block_priority(root)) {
+        free_tree_split(root, block, &block->smaller, &block->larger);
+        return block;
+    }
+    if (free_block_before(block, root)) {
+        root->smaller = free_tree_insert(root->smaller, block);
+    } else {
+        root->larger = free_tree_insert(root->larger, block);
+    }
+    return root;
+}
+
+/**
+ * Remove a block from a subtree (before its size or address changes)
+ */
+static MemoryBlock *free_tree_remove(MemoryBlock *root, const MemoryBlock *block) {
+    if (root == block) return free_tree_join(root->smaller, root->larger);
+    if (free_block_before(block, root)) {
+        root->smaller = free_tree_remove(root->smaller, block);
+    } else {
+        root->larger = free_tree_remove(root->larger, block);
+    }
+    return root;
+}
+
+/**
+ * Lowest-addressed free block of the smallest size that is at least size, or NULL
+ */
+static MemoryBlock *free_tree_lower_bound(MemoryBlock *root, long long size) {
+    MemoryBlock *found = NULL;
+    while (root != NULL) {
+        if (root->size >= size) {
+            found = root;
+            root = root->smaller;
+        } else {
+            root = root->larger;
+        }
+    }
+    return found;
+}
+
+/**
+ * TLSF class of a block size: the first level is the highest set bit, the second level
+ * the next TLSF_SL_SHIFT bits (sizes below TLSF_SL_COUNT share first level 0)
+ */
+static inline void tlsf_mapping(long long size, int *fl, int *sl) {
+    if (size < TLSF_SL_COUNT) {
+        *fl = 0;
+        *sl = (int)size;
+    } else {
+        int top = 63 - __builtin_clzll((unsigned long long)size);
+        *fl = top - TLSF_SL_SHIFT + 1;
+        *sl = (int)(size >> (top - TLSF_SL_SHIFT)) ^ TLSF_SL_COUNT;
+    }
+}
+
+/**
+ * Add a free block to the front of its class list
+ */
+static void tlsf_insert(TlsfIndex *tlsf, MemoryBlock *block) {
+    int fl, sl;
+    tlsf_mapping(block->size, &fl, &sl);
+
+    MemoryBlock *head = tlsf->free_lists[fl][sl];
+    block->prev_free = NULL;
+    block->next_free = head;
+    if (head != NULL) {
+        head->prev_free = block;
+    }
+    tlsf->free_lists[fl][sl] = block;
+    tlsf->fl_bitmap |= 1ULL << fl;
+    tlsf->sl_bitmap[fl] |= 1u << sl;
+}
+
+/**
+ * Unlink a free block from its class list (before its size changes)
+ */
+static void tlsf_remove(TlsfIndex *tlsf, MemoryBlock *block) {
+    int fl, sl;
+    tlsf_mapping(block->size, &fl, &sl);
+
+    if (block->prev_free != NULL) {
+        block->prev_free->next_free = block->next_free;
+    } else {
+        tlsf->free_lists[fl][sl] = block->next_free;
+    }
+    if (block->next_free != NULL) {
+        block->next_free->prev_free = block->prev_free;
+    }
+
+    if (tlsf->free_lists[fl][sl] == NULL) {
+        tlsf->sl_bitmap[fl] &= ~(1u << sl);
+        if (tlsf->sl_bitmap[fl] == 0) {
+            tlsf->fl_bitmap &= ~(1ULL << fl);
+        }
+    }
+}
+
+/**
+ * A free block of at least size bytes in O(1), or NULL
+ * The size is rounded up to the next class, so the first block of the first nonempty
+ * class at or above it always fits. Failing that, only the request's own class can
+ * still hold a fitting block, and its first block is tried.
+ */
+static MemoryBlock *tlsf_find(const TlsfIndex *tlsf, long long size) {
+    int fl, sl;
+    long long rounded = size;
+
+    if (size >= TLSF_SL_COUNT) {
+        rounded += (1LL << (63 - __builtin_clzll((unsigned long long)size) - TLSF_SL_SHIFT)) - 1;
+    }
+    tlsf_mapping(rounded, &fl, &sl);
+    unsigned int sl_map = tlsf->sl_bitmap[fl] & (~0u << sl);
+    if (sl_map == 0 && fl + 1 < TLSF_FL_COUNT) {
+        unsigned long long fl_map = tlsf->fl_bitmap & (~0ULL << (fl + 1));
+        if (fl_map != 0) {
+            fl = __builtin_ctzll(fl_map);
+            sl_map = tlsf->sl_bitmap[fl];
+        }
+    }
+    if (sl_map != 0) return tlsf->free_lists[fl][__builtin_ctz(sl_map)];
+
+    tlsf_mapping(size, &fl, &sl);
+    MemoryBlock *head = tlsf->free_lists[fl][sl];
+    return (head != NULL && head->size >= size) ? head : NULL;
+}
+
+/**
+ * Add a free block to whichever index holds the free blocks
+ */
+static inline void free_index_insert(MemoryManager *mm, MemoryBlock *block) {
+    if (mm->tlsf_indexed) {
+        tlsf_insert(&mm->tlsf, block);
+    } else {
+        mm->free_tree = free_tree_insert(mm->free_tree, block);
+    }
+}
+
+/**
+ * Remove a free block from whichever index holds the free blocks
+ */
+static inline void free_index_remove(MemoryManager *mm, MemoryBlock *block) {
+    if (mm->tlsf_indexed) {
+        tlsf_remove(&mm->tlsf, block);
+    } else {
+        mm->free_tree = free_tree_remove(mm->free_tree, block);
+    }
+}
+
+/**
+ * Whether no block of the list is allocated (the list is then one free block)
+ */
+static inline bool block_list_is_free(const MemoryManager *mm) {
+    return mm->memory_blocks->next == NULL && mm->memory_blocks->process_id == -1;
+}
+
+/**
+ * Keep the free blocks in the TLSF lists (tlsf) or the free tree
+ * Switching is only possible while the list is one free block. Returns false otherwise.
+ */
+static inline bool use_tlsf_index(MemoryManager *mm, bool tlsf) {
+    if (mm->tlsf_indexed == tlsf) return true;
+    if (!block_list_is_free(mm)) return false;
+
+    free_index_remove(mm, mm->memory_blocks);
+    mm->tlsf_indexed = tlsf;
+    free_index_insert(mm, mm->memory_blocks);
+    return true;
+}
+
+/**
+ * Allocate process i at the start of a free block, splitting off the rest as a new free block
+ * The block becomes the process's handle, so it can be released without a search.
+ */
+void claim_memory_block(MemoryManager *mm, ProcessTable *processes, int i, MemoryBlock *block) {
+    int memory_size = processes->memory_size[i];
+
+    free_index_remove(mm, block);
+    processes->allocated_address[i] = block->start_address;
+    processes->memory_block[i] = block;
+    block->process_id = processes->id[i];
+
+    // Split block if larger than needed
+    if (block->size > memory_size) {
+        MemoryBlock *new_block = block_pool_take(&mm->block_pool);
+        new_block->start_address = block->start_address + memory_size;
+        new_block->size = block->size - memory_size;
+        new_block->process_id = -1; // Free
+        new_block->next = block->next;
+        new_block->prev = block;
+        if (block->next != NULL) {
+            block->next->prev = new_block;
+        }
+
+        block->size = memory_size;
+        block->next = new_block;
+        free_index_insert(mm, new_block);
+    }
+}
+
+/**
+ * Allocate contiguous memory with a fixed algorithm
+ * Always inlined with a constant algorithm, so each specialization keeps only its own search.
+ */
+static inline __attribute__((always_inline))
+bool allocate_contiguous_as(MemoryManager *mm, ProcessTable *processes, int i, AllocationAlgorithm algorithm) {
+    int memory_size = processes->memory_size[i];
+    MemoryBlock *best_block = NULL;
+
+    // The buddy system holds the address space until its blocks are freed
+    if (mm->buddy.live_blocks > 0) return false;
+
+    // Best and worst fit search the tree, TLSF its class lists
+    if ((algorithm == BEST_FIT || algorithm == WORST_FIT) && !use_tlsf_index(mm, false)) return false;
+    if (algorithm == TLSF && !use_tlsf_index(mm, true)) return false;
+
+    // Find suitable block based on algorithm
+    if (algorithm == FIRST_FIT) {
+        for (MemoryBlock *current = mm->memory_blocks; current != NULL; current = current->next) {
+            if (current->process_id == -1 && current->size >= memory_size) {
+                best_block = current;
+                break;
+            }
+        }
+    } else if (algorithm == BEST_FIT) {
+        best_block = free_tree_lower_bound(mm->free_tree, memory_size);
+    } else if (algorithm == WORST_FIT) {
+        // Largest size first, then the lowest address of that size
+        MemoryBlock *largest = mm->free_tree;
+        while (largest != NULL && largest->larger != NULL) {
+            largest = largest->larger;
+        }
+        if (largest != NULL && largest->size >= memory_size) {
+            best_block = free_tree_lower_bound(mm->free_tree, largest->size);
+        }
+    } else if (algorithm == TLSF) {
+        best_block = tlsf_find(&mm->tlsf, memory_size);
+    }
+
+    if (best_block == NULL) return false;
+
+    claim_memory_block(mm, processes, i, best_block);
+    return true;
+}
+
+// One contiguous allocator per algorithm
+#define DEFINE_CONTIGUOUS_ALLOCATOR(name, algorithm)                           \
+    static bool name(MemoryManager *mm, ProcessTable *processes, int i) {      \
+        return allocate_contiguous_as(mm, processes, i, algorithm);            \
+    }
+
+DEFINE_CONTIGUOUS_ALLOCATOR(allocate_first_fit, FIRST_FIT)
+DEFINE_CONTIGUOUS_ALLOCATOR(allocate_best_fit, BEST_FIT)
+DEFINE_CONTIGUOUS_ALLOCATOR(allocate_worst_fit, WORST_FIT)
+DEFINE_CONTIGUOUS_ALLOCATOR(allocate_tlsf, TLSF)
+
+/**
+ * Allocate contiguous memory from the buddy system
+ * The request is rounded up to a power-of-two block. The smallest free block at least
+ * that large is found from the nonempty mask and split in halves down to size; the
+ * upper halves go back on the free lists. Only allowed while the block list is all free.
+ */
+static bool allocate_buddy(MemoryManager *mm, ProcessTable *processes, int i) {
+    BuddyAllocator *buddy = &mm->buddy;
+    int memory_size = processes->memory_size[i];
+
+    if (!block_list_is_free(mm)) return false;
+
+    // Order of the smallest block that holds the request
+    long long units = ((long long)memory_size + (1LL << buddy->unit_shift) - 1) >> buddy->unit_shift;
+    int order = 0;
+    while ((1LL << order) < units) {
+        order++;
+    }
+    if (order > buddy->max_order) return false;
+
+    unsigned int candidates = buddy->nonempty & ~((1u << order) - 1);
+    if (candidates == 0) return false;
+
+    int found = __builtin_ctz(candidates);
+    int unit = buddy->free_head[found];
+    buddy_remove(buddy, found, unit);
+    while (found > order) {
+        found--;
+        buddy_push(buddy, found, unit + (1 << found));
+    }
+
+    buddy->order[unit] = (signed char)order;
+    buddy->process_id[unit] = processes->id[i];
+    processes->allocated_address[i] = (long long)unit << buddy->unit_shift;
+
+    long long block_bytes = (long long)(1 << order) << buddy->unit_shift;
+    buddy->live_blocks++;
+    buddy->allocations++;
+    buddy->requested_bytes += memory_size;
+    buddy->allocated_bytes += block_bytes;
+    if (buddy->allocated_bytes - buddy->requested_bytes > buddy->peak_internal) {
+        buddy->peak_internal = buddy->allocated_bytes - buddy->requested_bytes;
+    }
+    return true;
+}
+
+/**
+ * Free a buddy block, merging it with its buddy for as long as the buddy is free
+ */
+static void release_buddy_block(BuddyAllocator *buddy, int unit, int memory_size) {
+    int order = buddy->order[unit];
+
+    buddy->live_blocks--;
+    buddy->requested_bytes -= memory_size;
+    buddy->allocated_bytes -= (long long)(1 << order) << buddy->unit_shift;
+
+    while (order < buddy->max_order) {
+        int other = unit ^ (1 << order);
+        if ((other >> order) >= (buddy->num_units >> order) || !buddy_is_free(buddy, order, other)) break;
+        buddy_remove(buddy, order, other);
+        if (other < unit) unit = other;
+        order++;
+    }
+    buddy_push(buddy, order, unit);
+}
+
+// Indexed by AllocationAlgorithm
+static const ContiguousAllocator contiguous_allocators[] = {
+    allocate_first_fit,
+    allocate_best_fit,
+    allocate_worst_fit,
+    allocate_buddy,
+    allocate_tlsf
+};
+
+/**
+ * Contiguous allocator specialized for an algorithm, NULL if the algorithm is unknown
+ */
+ContiguousAllocator contiguous_allocator(AllocationAlgorithm algorithm) {
+    if ((unsigned int)algorithm >= sizeof(contiguous_allocators) / sizeof(contiguous_allocators[0])) return NULL;
+    return contiguous_allocators[algorithm];
+}
+
+/**
+ * Allocate contiguous memory using specified algorithm
+ */
+bool allocate_memory_contiguous(MemoryManager *mm, ProcessTable *processes, int i, AllocationAlgorithm algorithm) {
+    ContiguousAllocator allocate = contiguous_allocator(algorithm);
+    return allocate != NULL && allocate(mm, processes, i);
+}
+
+/**
+ * Free an allocated block and merge it with free neighbors
+ * The neighbor links make the merge O(1); only the free tree update is O(log n).
+ */
+void release_memory_block(MemoryManager *mm, MemoryBlock *block) {
+    block->process_id = -1; // Mark as free
+
+    // Merge with next block if free
+    MemoryBlock *next_block = block->next;
+    if (next_block != NULL && next_block->process_id == -1) {
+        free_index_remove(mm, next_block);
+        block->size += next_block->size;
+        block->next = next_block->next;
+        if (block->next != NULL) {
+            block->next->prev = block;
+        }
+        block_pool_give(&mm->block_pool, next_block);
+    }
+
+    // Merge with previous block if free
+    MemoryBlock *prev_block = block->prev;
+    if (prev_block != NULL && prev_block->process_id == -1) {
+        free_index_remove(mm, prev_block);
+        prev_block->size += block->size;
+        prev_block->next = block->next;
+        if (prev_block->next != NULL) {
+            prev_block->next->prev = prev_block;
+        }
+        block_pool_give(&mm->block_pool, block);
+        block = prev_block;
+    }
+
+    // The merged block is indexed under its new size
+    free_index_insert(mm, block);
+}
+
+/**
+ * Deallocate contiguous memory through the process's block handle
+ * Buddy blocks have no handle; they are found from the address instead.
+ */
+void deallocate_memory_contiguous(MemoryManager *mm, ProcessTable *processes, int i) {
+    if (processes->memory_block[i] == NULL) {
+        if (processes->allocated_address[i] != -1) {
+            release_buddy_block(&mm->buddy, (int)(processes->allocated_address[i] >> mm->buddy.unit_shift),
+                                processes->memory_size[i]);
+            processes->allocated_address[i] = -1;
+        }
+        return;
+    }
+
+    release_memory_block(mm, processes->memory_block[i]);
+    processes->memory_block[i] = NULL;
+    processes->allocated_address[i] = -1;
+}
+
+/**
+ * Allocate pages with a fixed page replacement algorithm
+ * Always inlined with a constant algorithm, like allocate_contiguous_as.
+ */
+static inline __attribute__((always_inline))
+bool allocate_pages_as(MemoryManager *mm, ProcessTable *processes, int i, PageReplacementAlgorithm algorithm) {
+    int *page_table = process_page_table(processes, i);
+    int allocated_pages = 0;
+
+    // Lowest free frames for as many pages as possible, in one batch
+    int free_pages = frame_bitmap_take(&mm->free_frames, page_table, processes->pages_needed[i]);
+    
+    for (int page = 0; page < processes->pages_needed[i]; page++) {
+        int free_frame = (page < free_pages) ? page_table[page] : -1;
+        
+        // Use page replacement if no free frame
+        if (free_frame == -1) {
+            mm->page_replacements++;
+            if (algorithm == FIFO) {
+                free_frame = mm->fifo_queue[mm->fifo_front];
+                mm->fifo_front = (mm->fifo_front + 1) % mm->num_pages;
+            } else if (algorithm == LRU) {
+                free_frame = find_lru_page(mm);
+            }
+        }
+        
+        // Allocate frame
+        mm->page_frames.process_id[free_frame] = processes->id[i];
+        mm->page_frames.page_number[free_frame] = (unsigned short)page;
+        mm->page_frames.last_access_time[free_frame] = mm->current_time++;
+        
+        page_table[page] = free_frame;
+        
+        // Add to FIFO queue if new allocation
+        if (algorithm == FIFO) {
+            mm->fifo_queue[mm->fifo_rear] = free_frame;
+            mm->fifo_rear = (mm->fifo_rear + 1) % mm->num_pages;
+        }
+        
+        allocated_pages++;
+    }
+    
+    return allocated_pages == processes->pages_needed[i];
+}
+
+// One page allocator per replacement algorithm
+#define DEFINE_PAGE_ALLOCATOR(name, algorithm)                                 \
+    static bool name(MemoryManager *mm, ProcessTable *processes, int i) {      \
+        return allocate_pages_as(mm, processes, i, algorithm);                 \
+    }
+
+DEFINE_PAGE_ALLOCATOR(allocate_pages_fifo, FIFO)
+DEFINE_PAGE_ALLOCATOR(allocate_pages_lru, LRU)
+
+// Indexed by PageReplacementAlgorithm
+static const PageAllocator page_allocators[] = {
+    allocate_pages_fifo,
+    allocate_pages_lru
+};
+
+/**
+ * Page allocator specialized for a replacement algorithm, NULL if the algorithm is unknown
+ */
+PageAllocator page_allocator(PageReplacementAlgorithm algorithm) {
+    if ((unsigned int)algorithm >= sizeof(page_allocators) / sizeof(page_allocators[0])) return NULL;
+    return page_allocators[algorithm];
+}
+
+/**
+ * Allocate pages using specified page replacement algorithm
+ */
+bool allocate_pages(MemoryManager *mm, ProcessTable *processes, int i, PageReplacementAlgorithm algorithm) {
+    PageAllocator allocate = page_allocator(algorithm);
+    return allocate != NULL && allocate(mm, processes, i);
+}
+
+/**
+ * Deallocate pages
+ */
+void deallocate_pages(MemoryManager *mm, ProcessTable *processes, int i) {
+    int *page_table = process_page_table(processes, i);
+
+    for (int page = 0; page < processes->pages_needed[i]; page++) {
+        int frame = page_table[page];
+        if (frame != -1) {
+            mm->page_frames.process_id[frame] = -1;
+            mm->page_frames.page_number[frame] = 0;
+            mm->page_frames.last_access_time[frame] = 0;
+            frame_bitmap_set(&mm->free_frames, frame);
+            page_table[page] = -1;
+        }
+    }
+}
+
+/**
+ * Find LRU page for replacement
+ */
+int find_lru_page(MemoryManager *mm) {
+    const int *last_access_time = mm->page_frames.last_access_time;
+    int lru_frame = 0;
+    int min_time = last_access_time[0];
+    
+    for (int i = 1; i < mm->num_pages; i++) {
+        if (last_access_time[i] < min_time) {
+            min_time = last_access_time[i];
+            lru_frame = i;
+        }
+    }
+    
+    return lru_frame;
+}
+
+/**
+ * Access a page (update LRU time)
+ */
+void access_page(MemoryManager *mm, int frame_index) {
+    if (frame_index >= 0 && frame_index < mm->num_pages) {
+        mm->page_frames.last_access_time[frame_index] = mm->current_time++;
+    }
+}
+
+/**
+ * Print how scattered the free memory is: the share of free bytes outside the largest free block
+ */
+static void print_external_fragmentation(long long free_bytes, int free_blocks, long long largest) {
+    printf("External fragmentation: %lld bytes free in %d block(s), largest %lld (%.1f%%)\n",
+           free_bytes, free_blocks, largest,
+           (free_bytes > 0) ? 100.0 * (double)(free_bytes - largest) / (double)free_bytes : 0.0);
+}
+
+/**
+ * Print the buddy blocks in address order, free blocks per order and both kinds of fragmentation
+ */
+static void print_buddy_status(const BuddyAllocator *buddy) {
+    long long free_bytes = 0;
+    long long largest = 0;
+    int free_blocks = 0;
+
+    printf("\nContiguous Memory Allocation (buddy system):\n");
+    printf("Address\tSize\tProcess\tStatus\n");
+    for (int unit = 0; unit < buddy->num_units; unit += 1 << buddy->order[unit]) {
+        int order = buddy->order[unit];
+        bool is_free = buddy_is_free(buddy, order, unit);
+        printf("%lld\t%lld\t%s\t%s\n",
+               (long long)unit << buddy->unit_shift,
+               (long long)(1 << order) << buddy->unit_shift,
+               is_free ? "N/A" : "",
+               is_free ? "FREE" : "ALLOCATED");
+        if (!is_free) {
+            printf("\t\tP%d\t\n", buddy->process_id[unit]);
+        }
+    }
+
+    printf("Free blocks by size:");
+    for (int k = 0; k <= buddy->max_order; k++) {
+        long long block_bytes = (long long)(1 << k) << buddy->unit_shift;
+        printf(" %lld:%d", block_bytes, buddy->free_count[k]);
+        free_bytes += block_bytes * buddy->free_count[k];
+        free_blocks += buddy->free_count[k];
+        if (buddy->free_count[k] > 0) largest = block_bytes;
+    }
+    printf("\n");
+
+    print_external_fragmentation(free_bytes, free_blocks, largest);
+    printf("Internal fragmentation: %lld bytes in %d live block(s) (%.1f%% of allocated), peak %lld\n",
+           buddy->allocated_bytes - buddy->requested_bytes, buddy->live_blocks,
+           (buddy->allocated_bytes > 0)
+               ? 100.0 * (double)(buddy->allocated_bytes - buddy->requested_bytes) / (double)buddy->allocated_bytes
+               : 0.0,
+           buddy->peak_internal);
+}
+
+/**
+ * Print memory status
+ */
+void print_memory_status(MemoryManager *mm, const ProcessTable *processes) {
+    printf("\n---Memory Management Status---\n");
+    
+    // Print contiguous memory allocation
+    if (mm->buddy.allocations > 0) {
+        print_buddy_status(&mm->buddy);
+    } else {
+        long long free_bytes = 0;
+        long long largest = 0;
+        int free_blocks = 0;
+
+        printf("\nContiguous Memory Allocation:\n");
+        printf("Address\tSize\tProcess\tStatus\n");
+        MemoryBlock *current = mm->memory_blocks;
+        while (current != NULL) {
+            printf("%lld\t%lld\t%s\t%s\n", 
+                   current->start_address, 
+                   current->size,
+                   current->process_id == -1 ? "N/A" : "",
+                   current->process_id == -1 ? "FREE" : "ALLOCATED");
+            if (current->process_id != -1) {
+                printf("\t\tP%d\t\n", current->process_id);
+            } else {
+                free_bytes += current->size;
+                free_blocks++;
+                if (current->size > largest) largest = current->size;
+            }
+            current = current->next;
+        }
+        print_external_fragmentation(free_bytes, free_blocks, largest);
+    }
+    printf("Block pool: %d slab(s) of %d nodes, %lld in use, peak %lld, %lld of %lld nodes recycled\n",
+           mm->block_pool.num_slabs, MEMORY_BLOCK_SLAB_BLOCKS, mm->block_pool.in_use,
+           mm->block_pool.peak_in_use, mm->block_pool.recycled, mm->block_pool.taken);
+    
+    // Print page allocation
+    printf("\nPage Allocation:\n");
+    printf("Frame\tProcess\tPage\tLast Access\n");
+    for (int i = 0; i < mm->num_pages; i++) {
+        if (mm->page_frames.process_id[i] != -1) {
+            printf("%d\tP%d\t%d\t%d\n", 
+                   i, 
+                   mm->page_frames.process_id[i],
+                   mm->page_frames.page_number[i],
+                   mm->page_frames.last_access_time[i]);
+        }
+    }
+    
+    // Print process memory information
+    printf("\nProcess Memory Information:\n");
+    printf("PID\tMemory Size\tPages Needed\tContiguous Addr\tPage Allocation\n");
+    for (int i = 0; i < processes->count; i++) {
+        const int *page_table = process_page_table(processes, i);
+
+        printf("%d\t%d\t\t%d\t\t%lld\t\t", 
+               process_id(processes, i),
+               process_memory_size(processes, i),
+               process_pages_needed(processes, i),
+               process_allocated_address(processes, i));
+        
+        for (int j = 0; j < process_pages_needed(processes, i); j++) {
+            if (page_table[j] != -1)
+                printf("F%d ", page_table[j]);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
@@ -0,0 +1,188 @@
+#ifndef MEMORY_MANAGER_H
+#define MEMORY_MANAGER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "process.h"
+
+// Default memory configuration (init_memory_manager takes the sizes at runtime)
+#define MEMORY_SIZE 1024
+#define PAGE_SIZE 64
+
+// MemoryBlock nodes carved from each pool slab
+#define MEMORY_BLOCK_SLAB_BLOCKS 256
+
+// TLSF size classes: first level by power of two, TLSF_SL_COUNT linear classes within each
+#define TLSF_SL_SHIFT 4
+#define TLSF_SL_COUNT (1 << TLSF_SL_SHIFT)
+#define TLSF_FL_COUNT 64
+
+// Buddy system: the smallest block is 16 bytes, or larger when memory would need more units
+#define BUDDY_MIN_SHIFT 4
+#define BUDDY_MAX_UNITS (1 << 20)
+#define BUDDY_MAX_ORDERS 32
+
+// Memory block for contiguous allocation, linked to both neighbors in address order
+typedef struct MemoryBlock {
+    long long start_address;
+    long long size;
+    int process_id;
+    struct MemoryBlock *next;
+    struct MemoryBlock *prev;
+
+    // Links of the free block index (only while the block is free): children in the
+    // free tree, or neighbors in a TLSF size-class list
+    union {
+        struct {
+            struct MemoryBlock *smaller;
+            struct MemoryBlock *larger;
+        };
+        struct {
+            struct MemoryBlock *prev_free;
+            struct MemoryBlock *next_free;
+        };
+    };
+} MemoryBlock;
+
+// Slab of block nodes; slabs are chained and kept until the manager is cleaned up
+typedef struct MemoryBlockSlab {
+    struct MemoryBlockSlab *next;
+    MemoryBlock blocks[MEMORY_BLOCK_SLAB_BLOCKS];
+} MemoryBlockSlab;
+
+// Pool of MemoryBlock nodes: freed nodes are recycled through a free list
+typedef struct {
+    MemoryBlockSlab *slabs;
+    MemoryBlockSlab *current; // Slab being carved, NULL before the first node
+    int carved;               // Nodes handed out from current
+    MemoryBlock *free_list;   // Linked through next
+    int num_slabs;
+
+    // Statistics since the last reset
+    long long in_use;
+    long long peak_in_use;
+    long long taken;
+    long long recycled; // Nodes served from the free list
+} MemoryBlockPool;
+
+// Two-level segregated fit index of the free blocks (used by TLSF)
+// A set bit in fl_bitmap means some list of that first level is nonempty, and a set bit
+// k in sl_bitmap[fl] means free_lists[fl][k] is nonempty, so a fitting class is found
+// with two find-first-set instructions.
+typedef struct {
+    unsigned long long fl_bitmap;
+    unsigned int sl_bitmap[TLSF_FL_COUNT];
+    MemoryBlock *free_lists[TLSF_FL_COUNT][TLSF_SL_COUNT];
+} TlsfIndex;
+
+// Buddy allocator over the same address space as the block list (used by BUDDY)
+// Memory is cut into units of the smallest block. A block of order k spans 1 << k units
+// and starts at a unit index aligned to 1 << k, so its buddy starts at index ^ (1 << k).
+typedef struct {
+    int unit_shift; // log2 of the unit size in bytes
+    int num_units;
+    int max_order;
+    int free_head[BUDDY_MAX_ORDERS]; // First unit of a free block of each order, -1 if none
+    int free_count[BUDDY_MAX_ORDERS];
+    unsigned int nonempty;           // Bit k set while order k has a free block
+    int *next_free;                  // Free list links, kept at a free block's first unit
+    int *prev_free;
+    signed char *order;              // Order of the block starting at a unit
+    int *process_id;                 // Owner of the allocated block starting at a unit
+    unsigned long long *free_bits;   // One bit per block of each order: free at exactly that order
+    int bit_offset[BUDDY_MAX_ORDERS];
+
+    // Statistics since the last reset
+    int live_blocks;
+    long long requested_bytes; // Asked for by the live blocks
+    long long allocated_bytes; // Held by the live blocks
+    long long peak_internal;   // Largest allocated - requested seen
+    long long allocations;
+} BuddyAllocator;
+
+// Most levels of the free-frame bitmap (64^6 frames is more than an int can count)
+#define FRAME_BITMAP_MAX_LEVELS 6
+
+// Free page frames as a hierarchical bitmap
+// Level 0 has one bit per frame, set while the frame is free. Each level above has one
+// bit per word of the level below, set while that word has a free frame, and the top
+// level is a single word, so the lowest free frame is one count-trailing-zeros per level.
+typedef struct {
+    unsigned long long *words[FRAME_BITMAP_MAX_LEVELS];
+    int num_words[FRAME_BITMAP_MAX_LEVELS];
+    int num_levels;
+    int free_count;
+} FrameBitmap;
+
+// Page frames, one packed column per field (10 bytes per frame)
+typedef struct {
+    int *process_id;              // -1 while the frame is free
+    int *last_access_time;
+    unsigned short *page_number;  // Below PROCESS_PAGES_LIMIT
+} PageFrameTable;
+
+// Memory management system
+typedef struct {
+    long long memory_size;
+    int page_size;
+    int num_pages;
+    MemoryBlock *memory_blocks;
+    MemoryBlock *free_tree; // Free blocks ordered by (size, address)
+    TlsfIndex tlsf;
+    bool tlsf_indexed;      // Free blocks are in the TLSF lists instead of the free tree
+    MemoryBlockPool block_pool;
+    BuddyAllocator buddy; // Either the list or the buddy system holds blocks, never both
+    PageFrameTable page_frames;
+    FrameBitmap free_frames;
+    int *fifo_queue;
+
+    // The frame columns, FIFO queue and free-frame bitmap share one mapping made at init
+    void *frame_storage;
+    size_t frame_storage_bytes;
+    int fifo_front, fifo_rear;
+    int current_time;
+
+    // Statistics for the run
+    int failed_allocations;
+    int page_replacements;
+    bool print_warnings; // Schedulers print a warning for each failed allocation
+} MemoryManager;
+
+// Allocation algorithms
+typedef enum {
+    FIRST_FIT,
+    BEST_FIT,
+    WORST_FIT,
+    BUDDY,
+    TLSF
+} AllocationAlgorithm;
+
+// Page replacement algorithms
+typedef enum {
+    FIFO,
+    LRU
+} PageReplacementAlgorithm;
+
+// Allocators specialized for one algorithm (see contiguous_allocator and page_allocator)
+typedef bool (*ContiguousAllocator)(MemoryManager *mm, ProcessTable *processes, int i);
+typedef bool (*PageAllocator)(MemoryManager *mm, ProcessTable *processes, int i);
+
+// Memory management functions
+long long parse_memory_size(const char *text, char **end);
+bool check_memory_config(long long memory_size, long long page_size);
+void init_memory_manager(MemoryManager *mm, long long memory_size, int page_size);
+void reset_memory_manager(MemoryManager *mm);
+void cleanup_memory_manager(MemoryManager *mm);
+ContiguousAllocator contiguous_allocator(AllocationAlgorithm algorithm);
+PageAllocator page_allocator(PageReplacementAlgorithm algorithm);
+void claim_memory_block(MemoryManager *mm, ProcessTable *processes, int i, MemoryBlock *block);
+void release_memory_block(MemoryManager *mm, MemoryBlock *block);
+bool allocate_memory_contiguous(MemoryManager *mm, ProcessTable *processes, int i, AllocationAlgorithm algorithm);
+void deallocate_memory_contiguous(MemoryManager *mm, ProcessTable *processes, int i);
+bool allocate_pages(MemoryManager *mm, ProcessTable *processes, int i, PageReplacementAlgorithm algorithm);
+void deallocate_pages(MemoryManager *mm, ProcessTable *processes, int i);
+void print_memory_status(MemoryManager *mm, const ProcessTable *processes);
+int find_lru_page(MemoryManager *mm);
+void access_page(MemoryManager *mm, int frame_index);
+
+#endif // MEMORY_MANAGER_H
@@ -0,0 +1,149 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Multi-Level Feedback Queue (MLFQ) scheduling algorithm
+
+ * New processes enter the top level. Each level is a round robin queue with its own
+ * time quantum; a process that uses its whole quantum without finishing drops one
+ * level, so interactive (short) jobs stay near the top while batch jobs sink. Every
+ * boost_interval time units all waiting processes move back to the top level so
+ * long jobs cannot starve.
+ * A bitmap holds one bit per non-empty level, so finding the highest non-empty level
+ * is a single find-first-set no matter how many processes are queued.
+ * Like round_robin_schedule, arrivals at the end of a slice queue ahead of the preempted process.
+
+ * Input: processes.txt containing process information in format: process_id arrival_time burst_time
+ * Output: Gantt chart, waiting time, and turnaround time for each process
+ */
+
+#include "mlfq.h"
+
+/**
+ * Default configuration: MLFQ_LEVELS levels, quantum doubling from MLFQ_BASE_QUANTUM
+ */
+void mlfq_default_config(MlfqConfig *config) {
+    config->num_levels = MLFQ_LEVELS;
+    for (int level = 0; level < MLFQ_LEVELS; level++) {
+        config->quantum[level] = MLFQ_BASE_QUANTUM << level;
+    }
+    config->boost_interval = MLFQ_BOOST_INTERVAL;
+}
+
+/**
+ * Add a process to the back of a level and mark the level non-empty
+ */
+static void mlfq_push(MlfqQueue levels[], unsigned int *nonempty, int level, int index) {
+    MlfqQueue *queue = &levels[level];
+    queue->items[(queue->front + queue->count) % queue->capacity] = index;
+    queue->count++;
+    *nonempty |= 1u << level;
+}
+
+/**
+ * Remove the process at the front of a level
+ */
+static int mlfq_pop(MlfqQueue levels[], unsigned int *nonempty, int level) {
+    MlfqQueue *queue = &levels[level];
+    int index = queue->items[queue->front];
+    queue->front = (queue->front + 1) % queue->capacity;
+    if (--queue->count == 0) {
+        *nonempty &= ~(1u << level);
+    }
+    return index;
+}
+
+/**
+ * Policy: new arrivals enter the top level
+ */
+static void mlfq_admit(Simulation *sim, int p) {
+    MlfqState *state = (MlfqState *)sim->state;
+    state->level_of[p] = 0;
+    mlfq_push(state->levels, &state->nonempty, 0, p);
+}
+
+/**
+ * Policy: run the front process of the highest non-empty level
+ */
+static int mlfq_select(Simulation *sim) {
+    MlfqState *state = (MlfqState *)sim->state;
+    if (state->nonempty == 0) return -1;
+    return mlfq_pop(state->levels, &state->nonempty, __builtin_ctz(state->nonempty));
+}
+
+/**
+ * Policy: run for at most the quantum of the level it was queued at
+ */
+static int mlfq_slice(Simulation *sim, int p) {
+    MlfqState *state = (MlfqState *)sim->state;
+    int quantum = state->config->quantum[state->level_of[p]];
+    int remaining = sim->processes->remaining_time[p];
+    return (remaining > quantum) ? quantum : remaining;
+}
+
+/**
+ * Policy: demote a process that used its whole quantum, then apply a due boost
+ */
+static void mlfq_slice_end(Simulation *sim, int p, bool completed) {
+    MlfqState *state = (MlfqState *)sim->state;
+    const MlfqConfig *config = state->config;
+    int current_time = sim->current_time;
+
+    if (!completed) {
+        // Used the whole quantum: drop one level (the bottom level is plain round robin)
+        if (state->level_of[p] < config->num_levels - 1) {
+            state->level_of[p]++;
+        }
+        mlfq_push(state->levels, &state->nonempty, state->level_of[p], p);
+    }
+
+    // Periodic boost: every waiting process moves back to the top level
+    if (config->boost_interval > 0 && current_time >= state->next_boost) {
+        unsigned int lower = state->nonempty & ~1u;
+        while (lower != 0) {
+            int from = __builtin_ctz(lower);
+            lower &= lower - 1;
+            while (state->levels[from].count > 0) {
+                int index = mlfq_pop(state->levels, &state->nonempty, from);
+                state->level_of[index] = 0;
+                mlfq_push(state->levels, &state->nonempty, 0, index);
+            }
+        }
+        state->next_boost = (current_time / config->boost_interval + 1) * config->boost_interval;
+    }
+}
+
+static const SimPolicy mlfq_policy = { mlfq_admit, mlfq_select, mlfq_slice, mlfq_slice_end };
+
+/**
+ * MLFQ scheduling algorithm (preemptive at quantum boundaries)
+ */
+void mlfq_schedule(ProcessTable *processes, GanttSink *gantt, const MlfqConfig *config) {
+    int n = processes->count;
+    int num_levels = config->num_levels;
+    if (n <= 0 || num_levels <= 0 || num_levels > MLFQ_MAX_LEVELS) return;
+
+    // One ring buffer per level and the level each process is queued at
+    MlfqState state;
+    state.config = config;
+    state.nonempty = 0;
+    state.level_of = (int *)malloc(n * sizeof(int));
+    state.next_boost = config->boost_interval;
+    for (int level = 0; level < num_levels; level++) {
+        state.levels[level].items = (int *)malloc(n * sizeof(int));
+        state.levels[level].capacity = n;
+        state.levels[level].front = 0;
+        state.levels[level].count = 0;
+    }
+
+    Simulation sim;
+    sim_init(&sim, processes, gantt, &mlfq_policy, &state);
+    sim_run(&sim);
+    sim_free(&sim);
+
+    for (int level = 0; level < num_levels; level++) {
+        free(state.levels[level].items);
+    }
+    free(state.level_of);
+}
@@ -0,0 +1,47 @@
+#ifndef MLFQ_H
+#define MLFQ_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+#include "simulation.h"
+
+// Constants for Multi-Level Feedback Queue scheduling
+#define MLFQ_MAX_LEVELS 32
+#define MLFQ_LEVELS 3
+#define MLFQ_BASE_QUANTUM 3
+#define MLFQ_BOOST_INTERVAL 50
+
+// MLFQ configuration: level 0 is the highest priority level
+typedef struct {
+    int num_levels;
+    int quantum[MLFQ_MAX_LEVELS];
+    int boost_interval; // 0 disables the periodic boost
+} MlfqConfig;
+
+// One level: ring buffer of process indices (each process is queued at most once)
+typedef struct {
+    int *items;
+    int capacity;
+    int front;
+    int count;
+} MlfqQueue;
+
+// Policy state for the simulation engine
+typedef struct {
+    const MlfqConfig *config;
+    MlfqQueue levels[MLFQ_MAX_LEVELS];
+    unsigned int nonempty; // One bit per non-empty level
+    int *level_of;         // Level each process is queued at
+    int next_boost;
+} MlfqState;
+
+// Function declarations
+void mlfq_default_config(MlfqConfig *config);
+void mlfq_schedule(ProcessTable *processes, GanttSink *gantt, const MlfqConfig *config);
+
+#endif // MLFQ_H
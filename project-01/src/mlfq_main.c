@@ -0,0 +1,47 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Multi-Level Feedback Queue (MLFQ) driver program
+
+ * Usage: ./mlfq [trace]
+ */
+
+#include "mlfq.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const char *filename = (argc > 1) ? argv[1] : "processes.txt";
+    Arena arena;
+    ProcessTable processes;
+    GanttTextSink gantt;
+    MlfqConfig config;
+
+    // All process storage comes from one arena; the chart is printed as it is produced
+    arena_init(&arena);
+    gantt_text_sink_init(&gantt, stdout);
+    mlfq_default_config(&config);
+
+    // Read process data
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        arena_free(&arena);
+        return 1;
+    }
+
+    printf("---Multi-Level Feedback Queue (MLFQ) Scheduling---\n");
+    printf("Levels: %d, Quanta:", config.num_levels);
+    for (int level = 0; level < config.num_levels; level++) {
+        printf(" %d", config.quantum[level]);
+    }
+    printf(", Boost Interval: %d\n", config.boost_interval);
+
+    mlfq_schedule(&processes, &gantt.sink, &config);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+
+    arena_free(&arena);
+    return 0;
+}
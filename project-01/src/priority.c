@@ -0,0 +1,214 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Priority scheduling algorithms with aging
+
+ * The process with the best (lowest) priority number runs next. The non-preemptive
+ * version runs it to completion; the preemptive version switches as soon as a waiting
+ * process has a better effective priority than the running one.
+
+ * Aging: a process waiting since time w has effective priority
+ *     priority - (t - w) / aging_interval
+ * at time t. Scaling by aging_interval and dropping the -t term shared by every waiting
+ * process gives the heap key priority * aging_interval + w, which never changes while
+ * the process waits. Aging is therefore applied lazily through the key instead of
+ * walking the ready set every tick, and each event stays O(log n).
+
+ * Input: processes.txt containing process information in format: process_id arrival_time burst_time priority
+ * Output: Gantt chart, waiting time, and turnaround time for each process
+ */
+
+#include "priority.h"
+
+/**
+ * Heap key for a process that became ready at ready_since
+ */
+static long long aging_key(const ProcessTable *processes, int i, int ready_since, int aging_interval) {
+    if (aging_interval <= 0) return processes->priority[i];
+    return (long long)processes->priority[i] * aging_interval + ready_since;
+}
+
+/**
+ * Heap ordering: lower key first, then earlier arrival, then lower index
+ */
+static bool runs_before(const PriorityQueue *queue, const ProcessTable *processes, int a, int b) {
+    if (queue->key[a] != queue->key[b])
+        return queue->key[a] < queue->key[b];
+    if (processes->arrival_time[a] != processes->arrival_time[b])
+        return processes->arrival_time[a] < processes->arrival_time[b];
+    return a < b;
+}
+
+/**
+ * Add a ready process with the given key
+ */
+static void priority_queue_push(PriorityQueue *queue, const ProcessTable *processes, int index, long long key) {
+    int child = queue->size++;
+    queue->key[index] = key;
+
+    // Sift up
+    while (child > 0) {
+        int parent = (child - 1) / 2;
+        if (!runs_before(queue, processes, index, queue->heap[parent])) break;
+        queue->heap[child] = queue->heap[parent];
+        child = parent;
+    }
+    queue->heap[child] = index;
+}
+
+/**
+ * Remove and return the process with the best effective priority
+ */
+static int priority_queue_pop(PriorityQueue *queue, const ProcessTable *processes) {
+    int top = queue->heap[0];
+    int last = queue->heap[--queue->size];
+    int parent = 0;
+
+    // Sift down
+    while (2 * parent + 1 < queue->size) {
+        int child = 2 * parent + 1;
+        if (child + 1 < queue->size && runs_before(queue, processes, queue->heap[child + 1], queue->heap[child])) {
+            child++;
+        }
+        if (!runs_before(queue, processes, queue->heap[child], last)) break;
+        queue->heap[parent] = queue->heap[child];
+        parent = child;
+    }
+    queue->heap[parent] = last;
+
+    return top;
+}
+
+/**
+ * Policy: a newly arrived process waits since its arrival
+ */
+static void priority_admit(Simulation *sim, int p) {
+    PriorityState *state = (PriorityState *)sim->state;
+    priority_queue_push(&state->ready, sim->processes, p,
+                        aging_key(sim->processes, p, sim->processes->arrival_time[p], state->aging_interval));
+}
+
+/**
+ * Policy: run the process with the best effective priority
+ */
+static int priority_select(Simulation *sim) {
+    PriorityState *state = (PriorityState *)sim->state;
+    return (state->ready.size > 0) ? priority_queue_pop(&state->ready, sim->processes) : -1;
+}
+
+/**
+ * Policy: non-preemptive, so a process runs to completion
+ */
+static int priority_slice(Simulation *sim, int p) {
+    return sim->processes->remaining_time[p];
+}
+
+/**
+ * Policy: nothing to requeue when a process finishes
+ */
+static void priority_slice_end(Simulation *sim, int p, bool completed) {
+    (void)sim;
+    (void)p;
+    (void)completed;
+}
+
+static const SimPolicy priority_policy = { priority_admit, priority_select, priority_slice, priority_slice_end };
+
+/**
+ * Preemptive policy: keep the running process unless the best waiting one has overtaken it
+ */
+static int priority_preemptive_select(Simulation *sim) {
+    PriorityState *state = (PriorityState *)sim->state;
+    PriorityQueue *ready = &state->ready;
+    int current_time = sim->current_time;
+
+    // The running key drifts up relative to the waiting keys as they age
+    long long running_drift = (state->aging_interval > 0) ? current_time - state->dispatch_time : 0;
+
+    if (state->running != -1 && ready->size > 0 && ready->key[ready->heap[0]] < state->running_key + running_drift) {
+        // Preempt: the running process starts waiting again from now
+        priority_queue_push(ready, sim->processes, state->running,
+                            aging_key(sim->processes, state->running, current_time, state->aging_interval));
+        state->running = -1;
+    }
+
+    if (state->running == -1) {
+        if (ready->size == 0) return -1;
+        state->running = priority_queue_pop(ready, sim->processes);
+        state->running_key = ready->key[state->running];
+        state->dispatch_time = current_time;
+    }
+    return state->running;
+}
+
+/**
+ * Preemptive policy: run until completion, the next arrival, or the best waiting process overtakes
+ */
+static int priority_preemptive_slice(Simulation *sim, int p) {
+    PriorityState *state = (PriorityState *)sim->state;
+    int run_until = sim->current_time + sim->processes->remaining_time[p];
+    int next_arrival = sim_next_arrival_time(sim);
+
+    if (next_arrival < run_until) run_until = next_arrival;
+    if (state->aging_interval > 0 && state->ready.size > 0) {
+        long long overtake_time = state->ready.key[state->ready.heap[0]] - state->running_key + state->dispatch_time + 1;
+        if (overtake_time < run_until) {
+            run_until = (int)overtake_time;
+        }
+    }
+    return run_until - sim->current_time;
+}
+
+/**
+ * Preemptive policy: a finished process gives up the CPU
+ */
+static void priority_preemptive_slice_end(Simulation *sim, int p, bool completed) {
+    (void)p;
+    if (completed) {
+        ((PriorityState *)sim->state)->running = -1;
+    }
+}
+
+static const SimPolicy priority_preemptive_policy = {
+    priority_admit, priority_preemptive_select, priority_preemptive_slice, priority_preemptive_slice_end
+};
+
+/**
+ * Run a priority policy on the simulation engine
+ */
+static void priority_run(ProcessTable *processes, GanttSink *gantt, const SimPolicy *policy, int aging_interval) {
+    int n = processes->count;
+    if (n <= 0) return;
+
+    PriorityState state = {
+        { (int *)malloc(n * sizeof(int)), 0, (long long *)malloc(n * sizeof(long long)) },
+        aging_interval, -1, 0, 0
+    };
+    Simulation sim;
+    sim_init(&sim, processes, gantt, policy, &state);
+    sim_run(&sim);
+
+    sim_free(&sim);
+    free(state.ready.heap);
+    free(state.ready.key);
+}
+
+/**
+ * Priority scheduling algorithm (non-preemptive) with aging
+ */
+void priority_schedule(ProcessTable *processes, GanttSink *gantt, int aging_interval) {
+    priority_run(processes, gantt, &priority_policy, aging_interval);
+}
+
+/**
+ * Priority scheduling algorithm (preemptive) with aging
+ * The running process keeps the effective priority it had when dispatched, while the
+ * waiting processes keep aging, so the best waiting process overtakes it after a
+ * predictable delay. Time only advances to the next arrival, completion or overtake.
+ */
+void priority_preemptive_schedule(ProcessTable *processes, GanttSink *gantt, int aging_interval) {
+    // The sink merges consecutive slices of the same process into one entry
+    priority_run(processes, gantt, &priority_preemptive_policy, aging_interval);
+}
@@ -0,0 +1,36 @@
+#ifndef PRIORITY_H
+#define PRIORITY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+#include "simulation.h"
+
+// Default aging: a waiting process gains one priority level every AGING_INTERVAL time units
+#define AGING_INTERVAL 10
+
+// Ready queue: binary min-heap of process indices keyed on an aging-adjusted priority
+typedef struct {
+    int *heap;
+    int size;
+    long long *key; // One key per process, only meaningful while it is queued
+} PriorityQueue;
+
+// Policy state for the simulation engine
+typedef struct {
+    PriorityQueue ready;
+    int aging_interval;
+    int running;           // Preemptive only: process holding the CPU between slices, or -1
+    int dispatch_time;     // Preemptive only: when it was last dispatched
+    long long running_key; // Preemptive only: its key at dispatch
+} PriorityState;
+
+// Function declarations
+void priority_schedule(ProcessTable *processes, GanttSink *gantt, int aging_interval);
+void priority_preemptive_schedule(ProcessTable *processes, GanttSink *gantt, int aging_interval);
+
+#endif // PRIORITY_H
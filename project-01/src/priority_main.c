@@ -0,0 +1,52 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Priority scheduling driver program
+
+ * Usage: ./priority [trace] [aging_interval]
+ * Runs non-preemptive and then preemptive priority scheduling.
+ */
+
+#include "priority.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const char *filename = (argc > 1) ? argv[1] : "processes.txt";
+    int aging_interval = (argc > 2) ? atoi(argv[2]) : AGING_INTERVAL;
+    Arena arena;
+    ProcessTable processes;
+    GanttTextSink gantt;
+
+    // All process storage comes from one arena; the chart is printed as it is produced
+    arena_init(&arena);
+    gantt_text_sink_init(&gantt, stdout);
+
+    // Read process data
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        arena_free(&arena);
+        return 1;
+    }
+
+    printf("---Priority Scheduling (Aging Interval = %d)---\n", aging_interval);
+    printf("Lower priority numbers run first; 0 disables aging\n\n");
+
+    printf("---Non-Preemptive Priority Scheduling---\n");
+    priority_schedule(&processes, &gantt.sink, aging_interval);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+
+    // Reset process status
+    process_table_reset(&processes);
+
+    printf("\n---Preemptive Priority Scheduling---\n");
+    priority_preemptive_schedule(&processes, &gantt.sink, aging_interval);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+
+    arena_free(&arena);
+    return 0;
+}
@@ -0,0 +1,293 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Process table shared by the schedulers
+
+ * Processes are stored as a structure of arrays: the scheduling loops only touch the
+ * dense arrival/burst/remaining/completed columns, while memory management and
+ * reporting fields live in separate cold columns.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "process.h"
+#include "memory_manager.h"
+#include "trace.h"
+
+/**
+ * Allocate every column of a process table from the arena
+ */
+void process_table_init(ProcessTable *table, Arena *arena, int count) {
+    size_t ints = (size_t)count * sizeof(int);
+
+    table->count = count;
+    table->arrival_time = (int *)arena_alloc(arena, ints);
+    table->burst_time = (int *)arena_alloc(arena, ints);
+    table->remaining_time = (int *)arena_alloc(arena, ints);
+    table->priority = (int *)arena_alloc(arena, ints);
+    table->is_completed = (bool *)arena_alloc(arena, (size_t)count * sizeof(bool));
+
+    table->first_run_time = (int *)arena_alloc(arena, ints);
+    table->completion_time = (int *)arena_alloc(arena, ints);
+    table->turnaround_time = (int *)arena_alloc(arena, ints);
+    table->waiting_time = (int *)arena_alloc(arena, ints);
+    table->metrics = (ProcessMetrics *)arena_alloc(arena, sizeof(ProcessMetrics));
+
+    table->id = (int *)arena_alloc(arena, ints);
+    table->memory_size = (int *)arena_alloc(arena, ints);
+    table->allocated_address = (long long *)arena_alloc(arena, (size_t)count * sizeof(long long));
+    table->memory_block = (struct MemoryBlock **)arena_alloc(arena, (size_t)count * sizeof(struct MemoryBlock *));
+    table->pages_needed = (int *)arena_alloc(arena, ints);
+    table->page_table = (int *)arena_alloc(arena, ints * MAX_PROCESS_PAGES);
+    table->max_pages = MAX_PROCESS_PAGES;
+}
+
+/**
+ * Reset scheduling and memory state so the table can be scheduled again
+ */
+void process_table_reset(ProcessTable *table) {
+    for (int i = 0; i < table->count; i++) {
+        table->remaining_time[i] = table->burst_time[i];
+        table->is_completed[i] = false;
+        table->first_run_time[i] = -1;
+        table->allocated_address[i] = -1;
+        table->memory_block[i] = NULL;
+    }
+    process_metrics_init(table->metrics);
+    for (size_t j = 0; j < (size_t)table->count * table->max_pages; j++) {
+        table->page_table[j] = -1;
+    }
+}
+
+/**
+ * Make a private copy of a table for a concurrent run
+ * The trace columns (id, arrival, burst, priority, memory size) are shared read-only with
+ * the source; only the columns a scheduler writes are allocated from the arena.
+ */
+void process_table_clone(ProcessTable *copy, const ProcessTable *source, Arena *arena) {
+    int count = source->count;
+    size_t ints = (size_t)count * sizeof(int);
+
+    copy->count = count;
+    copy->arrival_time = source->arrival_time;
+    copy->burst_time = source->burst_time;
+    copy->priority = source->priority;
+    copy->id = source->id;
+    copy->memory_size = source->memory_size;
+
+    copy->remaining_time = (int *)arena_alloc(arena, ints);
+    copy->is_completed = (bool *)arena_alloc(arena, (size_t)count * sizeof(bool));
+    copy->first_run_time = (int *)arena_alloc(arena, ints);
+    copy->completion_time = (int *)arena_alloc(arena, ints);
+    copy->turnaround_time = (int *)arena_alloc(arena, ints);
+    copy->waiting_time = (int *)arena_alloc(arena, ints);
+    copy->metrics = (ProcessMetrics *)arena_alloc(arena, sizeof(ProcessMetrics));
+    copy->allocated_address = (long long *)arena_alloc(arena, (size_t)count * sizeof(long long));
+    copy->memory_block = (struct MemoryBlock **)arena_alloc(arena, (size_t)count * sizeof(struct MemoryBlock *));
+    copy->pages_needed = (int *)arena_alloc(arena, ints);
+    copy->page_table = (int *)arena_alloc(arena, ints * source->max_pages);
+    copy->max_pages = source->max_pages;
+
+    for (int i = 0; i < count; i++) {
+        copy->pages_needed[i] = source->pages_needed[i];
+    }
+    process_table_reset(copy);
+}
+
+/**
+ * Track up to max_pages pages per process instead of MAX_PROCESS_PAGES
+ * The page tables are reallocated from the arena and cleared, so call this before
+ * process_table_set_page_size. Returns false if max_pages is out of range.
+ */
+bool process_table_set_max_pages(ProcessTable *table, Arena *arena, int max_pages) {
+    if (max_pages <= 0 || max_pages > PROCESS_PAGES_LIMIT) {
+        printf("Error: Pages per process must be between 1 and %d\n", PROCESS_PAGES_LIMIT);
+        return false;
+    }
+
+    table->max_pages = max_pages;
+    table->page_table = (int *)arena_alloc(arena, (size_t)table->count * max_pages * sizeof(int));
+    for (size_t j = 0; j < (size_t)table->count * max_pages; j++) {
+        table->page_table[j] = -1;
+    }
+    return true;
+}
+
+/**
+ * Recompute the pages each process needs for a page size (capped at max_pages)
+ */
+void process_table_set_page_size(ProcessTable *table, int page_size) {
+    for (int i = 0; i < table->count; i++) {
+        table->pages_needed[i] = (int)(((long long)table->memory_size[i] + page_size - 1) / page_size);
+        if (table->pages_needed[i] > table->max_pages) {
+            table->pages_needed[i] = table->max_pages;
+        }
+    }
+}
+
+/**
+ * Read process data from file
+ * Format: PID Arrival_Time Burst_Time Priority
+ */
+int read_processes_from_file(const char *filename, Arena *arena, ProcessTable *table) {
+    Trace trace;
+    int count = trace_load(filename, arena, &trace, 0);
+    process_table_init(table, arena, count);
+
+    for (int i = 0; i < count; i++) {
+        table->id[i] = trace.id[i];
+        table->arrival_time[i] = trace.arrival_time[i];
+        table->burst_time[i] = trace.burst_time[i];
+        table->priority[i] = trace.priority[i];
+
+        // Initialize memory fields
+        table->memory_size[i] = 50 + (table->id[i] * 20);
+    }
+    process_table_set_page_size(table, PAGE_SIZE);
+
+    // Initialize process status and clear page tables
+    process_table_reset(table);
+
+    trace_close(&trace);
+    return count;
+}
+
+/**
+ * Sort process indices by arrival time (stable merge sort, ties keep file order)
+ */
+void sort_by_arrival(const ProcessTable *table, int order[]) {
+    const int *arrival_time = table->arrival_time;
+    int n = table->count;
+    int *buffer = (int *)malloc((size_t)n * sizeof(int));
+
+    for (int i = 0; i < n; i++) {
+        order[i] = i;
+    }
+
+    for (int width = 1; width < n; width *= 2) {
+        for (int left = 0; left < n; left += 2 * width) {
+            int mid = (left + width < n) ? left + width : n;
+            int right = (left + 2 * width < n) ? left + 2 * width : n;
+            int i = left, j = mid, k = left;
+
+            while (i < mid && j < right) {
+                if (arrival_time[order[j]] < arrival_time[order[i]]) {
+                    buffer[k++] = order[j++];
+                } else {
+                    buffer[k++] = order[i++];
+                }
+            }
+            while (i < mid) buffer[k++] = order[i++];
+            while (j < right) buffer[k++] = order[j++];
+        }
+        for (int i = 0; i < n; i++) {
+            order[i] = buffer[i];
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Record completion metrics for a finished process
+ */
+void record_completion(ProcessTable *table, int i, int completion_time) {
+    record_completion_into(table, i, completion_time, table->metrics);
+}
+
+/**
+ * Record completion metrics, adding the distributions to metrics instead of the table's own
+ * (lets threads that share a table each keep their own histograms and merge them later)
+ */
+void record_completion_into(ProcessTable *table, int i, int completion_time, ProcessMetrics *metrics) {
+    table->completion_time[i] = completion_time;
+    table->turnaround_time[i] = completion_time - table->arrival_time[i];
+    table->waiting_time[i] = table->turnaround_time[i] - table->burst_time[i];
+    table->is_completed[i] = true;
+
+    histogram_record(&metrics->waiting_time, table->waiting_time[i]);
+    histogram_record(&metrics->turnaround_time, table->turnaround_time[i]);
+    histogram_record(&metrics->response_time, table->first_run_time[i] - table->arrival_time[i]);
+}
+
+/**
+ * Clear the result distributions
+ */
+void process_metrics_init(ProcessMetrics *metrics) {
+    histogram_init(&metrics->waiting_time);
+    histogram_init(&metrics->turnaround_time);
+    histogram_init(&metrics->response_time);
+}
+
+/**
+ * Add one set of result distributions to another
+ */
+void process_metrics_merge(ProcessMetrics *into, const ProcessMetrics *from) {
+    histogram_merge(&into->waiting_time, &from->waiting_time);
+    histogram_merge(&into->turnaround_time, &from->turnaround_time);
+    histogram_merge(&into->response_time, &from->response_time);
+}
+
+/**
+ * Average waiting and turnaround times over all processes
+ */
+void compute_average_times(const ProcessTable *table, double *average_waiting, double *average_turnaround) {
+    long long total_waiting_time = 0;
+    long long total_turnaround_time = 0;
+
+    for (int i = 0; i < table->count; i++) {
+        total_waiting_time += table->waiting_time[i];
+        total_turnaround_time += table->turnaround_time[i];
+    }
+
+    *average_waiting = (table->count > 0) ? (double)total_waiting_time / table->count : 0.0;
+    *average_turnaround = (table->count > 0) ? (double)total_turnaround_time / table->count : 0.0;
+}
+
+/**
+ * Print one row of the percentile table
+ */
+static void print_percentile_row(const char *label, const Histogram *histogram) {
+    printf("%s%lld\t%lld\t%lld\t%lld\t%lld\n", label,
+           histogram_percentile(histogram, 50.0),
+           histogram_percentile(histogram, 90.0),
+           histogram_percentile(histogram, 99.0),
+           histogram_percentile(histogram, 99.9),
+           histogram->max);
+}
+
+/**
+ * Print scheduling results
+ */
+void print_scheduling_results(const ProcessTable *table) {
+    int n = table->count;
+    double average_waiting, average_turnaround;
+
+    printf("Process Statistics:\n");
+    printf("PID\tArrival\tBurst\tWaiting\tTurnaround\n");
+    printf("---\t-------\t-----\t-------\t----------\n");
+
+    for (int i = 0; i < n; i++) {
+        printf("%d\t%d\t%d\t%d\t%d\n",
+               process_id(table, i),
+               process_arrival_time(table, i),
+               process_burst_time(table, i),
+               process_waiting_time(table, i),
+               process_turnaround_time(table, i));
+    }
+
+    // Totals are 64-bit, so long traces cannot overflow them
+    compute_average_times(table, &average_waiting, &average_turnaround);
+    printf("\nAverage Waiting Time:    %.2f\n", average_waiting);
+    printf("Average Turnaround Time: %.2f\n", average_turnaround);
+    printf("Average Response Time:   %.2f\n", histogram_mean(&table->metrics->response_time));
+
+    printf("\nPercentiles:\n");
+    printf("Metric\t\tp50\tp90\tp99\tp99.9\tMax\n");
+    printf("------\t\t---\t---\t---\t-----\t---\n");
+    print_percentile_row("Waiting\t\t", &table->metrics->waiting_time);
+    print_percentile_row("Turnaround\t", &table->metrics->turnaround_time);
+    print_percentile_row("Response\t", &table->metrics->response_time);
+}
@@ -0,0 +1,85 @@
+#ifndef PROCESS_H
+#define PROCESS_H
+
+#include <stdbool.h>
+#include "arena.h"
+#include "histogram.h"
+
+// Pages tracked per process unless process_table_set_max_pages changes it
+#define MAX_PROCESS_PAGES 8
+
+// Largest per-process page count (frames keep page numbers in 16 bits)
+#define PROCESS_PAGES_LIMIT 65536
+
+struct MemoryBlock; // Defined by the memory manager
+
+// Distributions of the per-process results, recorded as processes complete
+typedef struct {
+    Histogram waiting_time;
+    Histogram turnaround_time;
+    Histogram response_time; // First dispatch minus arrival
+} ProcessMetrics;
+
+// Process table stored as one dense array per field (structure of arrays)
+typedef struct {
+    int count;
+
+    // Hot columns read by the scheduling loops
+    int *arrival_time;
+    int *burst_time;
+    int *remaining_time;
+    int *priority;
+    bool *is_completed;
+
+    // Results written once per process
+    int *first_run_time; // -1 until the process is first dispatched
+    int *completion_time;
+    int *turnaround_time;
+    int *waiting_time;
+    ProcessMetrics *metrics;
+
+    // Cold columns used for reporting and memory management
+    int *id;
+    int *memory_size;
+    long long *allocated_address;
+    struct MemoryBlock **memory_block; // Handle to the allocated block, NULL if none
+    int *pages_needed;
+    int *page_table; // max_pages entries per process
+    int max_pages;
+} ProcessTable;
+
+// Accessors for code that reads a single process at a time
+static inline int process_id(const ProcessTable *table, int i) { return table->id[i]; }
+static inline int process_arrival_time(const ProcessTable *table, int i) { return table->arrival_time[i]; }
+static inline int process_burst_time(const ProcessTable *table, int i) { return table->burst_time[i]; }
+static inline int process_priority(const ProcessTable *table, int i) { return table->priority[i]; }
+static inline int process_waiting_time(const ProcessTable *table, int i) { return table->waiting_time[i]; }
+static inline int process_turnaround_time(const ProcessTable *table, int i) { return table->turnaround_time[i]; }
+static inline int process_memory_size(const ProcessTable *table, int i) { return table->memory_size[i]; }
+static inline long long process_allocated_address(const ProcessTable *table, int i) { return table->allocated_address[i]; }
+static inline int process_pages_needed(const ProcessTable *table, int i) { return table->pages_needed[i]; }
+static inline int *process_page_table(const ProcessTable *table, int i) {
+    return table->page_table + (size_t)i * table->max_pages;
+}
+
+// Note the first dispatch of a process (for response time)
+static inline void record_dispatch(ProcessTable *table, int i, int time) {
+    if (table->first_run_time[i] < 0) table->first_run_time[i] = time;
+}
+
+// Process table functions
+void process_table_init(ProcessTable *table, Arena *arena, int count);
+void process_table_reset(ProcessTable *table);
+void process_table_clone(ProcessTable *copy, const ProcessTable *source, Arena *arena);
+bool process_table_set_max_pages(ProcessTable *table, Arena *arena, int max_pages);
+void process_table_set_page_size(ProcessTable *table, int page_size);
+int read_processes_from_file(const char *filename, Arena *arena, ProcessTable *table);
+void sort_by_arrival(const ProcessTable *table, int order[]);
+void record_completion(ProcessTable *table, int i, int completion_time);
+void record_completion_into(ProcessTable *table, int i, int completion_time, ProcessMetrics *metrics);
+void process_metrics_init(ProcessMetrics *metrics);
+void process_metrics_merge(ProcessMetrics *into, const ProcessMetrics *from);
+void compute_average_times(const ProcessTable *table, double *average_waiting, double *average_turnaround);
+void print_scheduling_results(const ProcessTable *table);
+
+#endif // PROCESS_H
@@ -0,0 +1,252 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Discrete-event simulation engine shared by the single-CPU schedulers
+
+ * Time only moves from one event to the next: arrivals come from the arrival-order
+ * cursor, slice ends and memory releases from a 4-ary heap. When the CPU is free and
+ * nothing is ready, the clock jumps straight to the earlier of the next arrival and
+ * the heap top, so idle gaps cost O(1) however long they are.
+ * After every event due at the current time has been handled, a free CPU asks the
+ * policy for the next process and how long to run it. The engine records the slice
+ * and posts its end event. Policies therefore only keep their ready set and never
+ * touch the clock.
+
+ * Input: ProcessTable and a SimPolicy
+ * Output: Gantt slices and per-process results in the table
+ */
+
+#include <string.h>
+#include "simulation.h"
+
+/**
+ * Heap ordering: earlier time, then event kind, then posting order
+ */
+static bool event_before(const SimEvent *a, const SimEvent *b) {
+    if (a->time != b->time) return a->time < b->time;
+    if (a->type != b->type) return a->type < b->type;
+    return a->sequence < b->sequence;
+}
+
+/**
+ * Post an event
+ */
+static void event_push(EventQueue *queue, int time, EventType type, int process) {
+    if (queue->size == queue->capacity) {
+        queue->capacity = (queue->capacity > 0) ? queue->capacity * 2 : 16;
+        queue->events = (SimEvent *)realloc(queue->events, queue->capacity * sizeof(SimEvent));
+    }
+
+    SimEvent event = { time, type, process, queue->next_sequence++ };
+    int child = queue->size++;
+
+    // Sift up
+    while (child > 0) {
+        int parent = (child - 1) / EVENT_HEAP_ARITY;
+        if (!event_before(&event, &queue->events[parent])) break;
+        queue->events[child] = queue->events[parent];
+        child = parent;
+    }
+    queue->events[child] = event;
+}
+
+/**
+ * Remove and return the earliest event
+ */
+static SimEvent event_pop(EventQueue *queue) {
+    SimEvent top = queue->events[0];
+    SimEvent last = queue->events[--queue->size];
+    int parent = 0;
+
+    // Sift down
+    while (true) {
+        int first = EVENT_HEAP_ARITY * parent + 1;
+        if (first >= queue->size) break;
+
+        int best = first;
+        int end = (first + EVENT_HEAP_ARITY < queue->size) ? first + EVENT_HEAP_ARITY : queue->size;
+        for (int child = first + 1; child < end; child++) {
+            if (event_before(&queue->events[child], &queue->events[best])) best = child;
+        }
+        if (!event_before(&queue->events[best], &last)) break;
+        queue->events[parent] = queue->events[best];
+        parent = best;
+    }
+    queue->events[parent] = last;
+
+    return top;
+}
+
+/**
+ * Prepare a simulation of a whole table under a policy
+ */
+void sim_init(Simulation *sim, ProcessTable *processes, GanttSink *gantt, const SimPolicy *policy, void *state) {
+    memset(sim, 0, sizeof(*sim));
+    sim->processes = processes;
+    sim->gantt = gantt;
+    sim->policy = policy;
+    sim->state = state;
+    sim->running = -1;
+
+    sim->arrival_order = (int *)malloc((processes->count > 0 ? processes->count : 1) * sizeof(int));
+    sort_by_arrival(processes, sim->arrival_order);
+    sim->next_arrival_time = (processes->count > 0) ? processes->arrival_time[sim->arrival_order[0]] : INT_MAX;
+}
+
+/**
+ * Allocate memory for each process when it first runs and release it when it completes
+ * The allocators for alloc_alg and page_alg are looked up once here, not on every dispatch.
+ */
+void sim_use_memory(Simulation *sim, MemoryManager *mm, AllocationAlgorithm alloc_alg,
+                    PageReplacementAlgorithm page_alg, bool pages_per_slice) {
+    sim->mm = mm;
+    sim->allocate_contiguous = contiguous_allocator(alloc_alg);
+    sim->allocate_pages = page_allocator(page_alg);
+    sim->pages_per_slice = pages_per_slice;
+    sim->memory_allocated = (bool *)calloc(sim->processes->count > 0 ? sim->processes->count : 1, sizeof(bool));
+}
+
+/**
+ * Allocate a process's memory the first time it is dispatched
+ */
+static void allocate_on_dispatch(Simulation *sim, int p) {
+    MemoryManager *mm = sim->mm;
+    if (sim->memory_allocated[p]) return;
+
+    bool contiguous_allocated = sim->allocate_contiguous != NULL && sim->allocate_contiguous(mm, sim->processes, p);
+    bool pages_allocated = sim->allocate_pages != NULL && sim->allocate_pages(mm, sim->processes, p);
+
+    if (!contiguous_allocated) {
+        mm->failed_allocations++;
+        if (mm->print_warnings) {
+            printf("Warning: Could not allocate contiguous memory for Process P%d\n", sim->processes->id[p]);
+        }
+    }
+    if (!pages_allocated) {
+        mm->failed_allocations++;
+        if (mm->print_warnings) {
+            printf("Warning: Could not allocate pages for Process P%d\n", sim->processes->id[p]);
+        }
+    }
+    sim->memory_allocated[p] = true;
+}
+
+/**
+ * Run the policy's next choice, if any, on the free CPU
+ */
+static void dispatch(Simulation *sim) {
+    ProcessTable *processes = sim->processes;
+    int p = sim->policy->select(sim);
+    if (p < 0) return;
+
+    if (sim->mm != NULL) {
+        allocate_on_dispatch(sim, p);
+    }
+
+    int execution_time = sim->policy->slice(sim, p);
+    record_dispatch(processes, p, sim->current_time);
+    gantt_add(sim->gantt, processes->id[p], sim->current_time, sim->current_time + execution_time);
+
+    // Simulate memory access during execution
+    if (sim->mm != NULL) {
+        const int *page_table = process_page_table(processes, p);
+        int accesses = processes->pages_needed[p];
+        if (sim->pages_per_slice && execution_time < accesses) accesses = execution_time;
+        for (int access = 0; access < accesses; access++) {
+            if (page_table[access] != -1) {
+                access_page(sim->mm, page_table[access]);
+            }
+        }
+    }
+
+    processes->remaining_time[p] -= execution_time;
+    sim->running = p;
+    event_push(&sim->events, sim->current_time + execution_time,
+               (processes->remaining_time[p] == 0) ? EVENT_COMPLETION : EVENT_QUANTUM_EXPIRY, p);
+}
+
+/**
+ * Handle one event from the heap
+ */
+static void handle_event(Simulation *sim, const SimEvent *event) {
+    int p = event->process;
+
+    switch (event->type) {
+        case EVENT_QUANTUM_EXPIRY:
+            sim->running = -1;
+            sim->policy->slice_end(sim, p, false);
+            break;
+        case EVENT_COMPLETION:
+            sim->running = -1;
+            record_completion(sim->processes, p, sim->current_time);
+            sim->completed++;
+            if (sim->mm != NULL) {
+                event_push(&sim->events, sim->current_time, EVENT_MEMORY_RELEASE, p);
+            }
+            sim->policy->slice_end(sim, p, true);
+            break;
+        case EVENT_MEMORY_RELEASE:
+            deallocate_memory_contiguous(sim->mm, sim->processes, p);
+            deallocate_pages(sim->mm, sim->processes, p);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Run the simulation until every process has completed
+ */
+void sim_run(Simulation *sim) {
+    int n = sim->processes->count;
+    EventQueue *events = &sim->events;
+
+    while (sim->completed < n) {
+        // Handle every event due now; arrivals come first
+        while (true) {
+            if (sim->next_arrival_time <= sim->current_time) {
+                sim->policy->admit(sim, sim->arrival_order[sim->next_arrival++]);
+                sim->next_arrival_time = (sim->next_arrival < n)
+                    ? sim->processes->arrival_time[sim->arrival_order[sim->next_arrival]] : INT_MAX;
+            } else if (events->size > 0 && events->events[0].time <= sim->current_time) {
+                SimEvent event = event_pop(events);
+                handle_event(sim, &event);
+            } else {
+                break;
+            }
+        }
+        if (sim->completed == n) break;
+
+        if (sim->running == -1) {
+            dispatch(sim);
+        }
+
+        // Jump to the next event (a zero-length slice ends right now)
+        int next_time = sim->next_arrival_time;
+        if (events->size > 0 && events->events[0].time < next_time) {
+            next_time = events->events[0].time;
+        }
+        if (next_time == INT_MAX) break;
+        sim->current_time = next_time;
+    }
+
+    // Memory released by the last completions
+    while (events->size > 0) {
+        SimEvent event = event_pop(events);
+        handle_event(sim, &event);
+    }
+}
+
+/**
+ * Release the engine's own storage
+ */
+void sim_free(Simulation *sim) {
+    free(sim->arrival_order);
+    free(sim->events.events);
+    free(sim->memory_allocated);
+    sim->arrival_order = NULL;
+    sim->events.events = NULL;
+    sim->memory_allocated = NULL;
+}
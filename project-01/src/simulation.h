@@ -0,0 +1,88 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include "gantt.h"
+#include "process.h"
+#include "memory_manager.h"
+
+// Children per node of the event heap
+#define EVENT_HEAP_ARITY 4
+
+// Event kinds; events due at the same time are handled in this order
+typedef enum {
+    EVENT_ARRIVAL,
+    EVENT_QUANTUM_EXPIRY,  // Slice ended with work left
+    EVENT_COMPLETION,      // Slice ended with the process finished
+    EVENT_MEMORY_RELEASE
+} EventType;
+
+// Timestamped event
+typedef struct {
+    int time;
+    EventType type;
+    int process;
+    unsigned int sequence; // Equal (time, type) events run in the order they were posted
+} SimEvent;
+
+// Pending events: 4-ary min-heap on (time, type, sequence)
+typedef struct {
+    SimEvent *events;
+    int size;
+    int capacity;
+    unsigned int next_sequence;
+} EventQueue;
+
+typedef struct Simulation Simulation;
+
+// Scheduling policy: the engine owns time and the CPU, the policy owns the ready set
+typedef struct {
+    void (*admit)(Simulation *sim, int process);                     // Process arrived
+    int (*select)(Simulation *sim);                                  // Next process to run, or -1
+    int (*slice)(Simulation *sim, int process);                      // Time to run it (0..remaining)
+    void (*slice_end)(Simulation *sim, int process, bool completed); // Its slice is over
+} SimPolicy;
+
+// Single-CPU discrete-event simulation
+struct Simulation {
+    ProcessTable *processes;
+    GanttSink *gantt;
+    const SimPolicy *policy;
+    void *state; // Policy data
+    int current_time;
+    int running; // -1 while the CPU is free
+    int completed;
+    EventQueue events;
+
+    // Arrivals are already sorted, so they are read from a cursor instead of the heap
+    int *arrival_order;
+    int next_arrival;
+    int next_arrival_time; // Cached arrival time at the cursor, INT_MAX when none is left
+
+    // Optional memory management (mm is NULL without it), bound to specialized allocators
+    MemoryManager *mm;
+    ContiguousAllocator allocate_contiguous;
+    PageAllocator allocate_pages;
+    bool pages_per_slice; // Touch at most one page per time unit of a slice
+    bool *memory_allocated;
+};
+
+/**
+ * Arrival time of the next process still to arrive, INT_MAX if none is left
+ */
+static inline int sim_next_arrival_time(const Simulation *sim) {
+    return sim->next_arrival_time;
+}
+
+// Simulation functions
+void sim_init(Simulation *sim, ProcessTable *processes, GanttSink *gantt, const SimPolicy *policy, void *state);
+void sim_use_memory(Simulation *sim, MemoryManager *mm, AllocationAlgorithm alloc_alg,
+                    PageReplacementAlgorithm page_alg, bool pages_per_slice);
+void sim_run(Simulation *sim);
+void sim_free(Simulation *sim);
+
+#endif // SIMULATION_H
@@ -6,92 +6,21 @@
 #include <stdbool.h>
 #include <limits.h>
 
-// Constants for SJF scheduling
-#define MAX_PROCESSES 100
-#define MAX_GANTT_ENTRIES 200
-#define MEMORY_SIZE 1024
-#define PAGE_SIZE 64
-#define NUM_PAGES (MEMORY_SIZE / PAGE_SIZE)
-#define MAX_PROCESS_PAGES 8
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+#include "memory_manager.h"
+#include "simulation.h"
 
-// Process structure for SJF
+// Ready queue: binary min-heap of process indices keyed on (burst_time, arrival_time, index)
 typedef struct {
-    int id;
-    int arrival_time;
-    int burst_time;
-    int completion_time;
-    int turnaround_time;
-    int waiting_time;
-    bool is_completed;
-    
-    // Memory management fields
-    int memory_size;
-    int allocated_address;
-    int pages_needed;
-    int page_table[MAX_PROCESS_PAGES];
-} Process;
-
-// Gantt chart entry
-typedef struct {
-    int process_id;
-    int start_time;
-    int end_time;
-} GanttEntry;
-
-// Memory block for contiguous allocation
-typedef struct MemoryBlock {
-    int start_address;
+    int *heap;
     int size;
-    int process_id;
-    struct MemoryBlock *next;
-} MemoryBlock;
-
-// Page frame structure
-typedef struct {
-    int process_id;
-    int page_number;
-    int last_access_time;
-} PageFrame;
-
-// Memory management system
-typedef struct {
-    MemoryBlock *memory_blocks;
-    PageFrame page_frames[NUM_PAGES];
-    int fifo_queue[NUM_PAGES];
-    int fifo_front, fifo_rear;
-    int current_time;
-} MemoryManager;
-
-// Allocation algorithms
-typedef enum {
-    FIRST_FIT,
-    BEST_FIT,
-    WORST_FIT
-} AllocationAlgorithm;
-
-// Page replacement algorithms
-typedef enum {
-    FIFO,
-    LRU
-} PageReplacementAlgorithm;
+} SjfQueue;
 
 // Function declarations
-int read_processes_from_file(const char *filename, Process processes[]);
-void sjf_schedule(Process processes[], int n, GanttEntry gantt[], int *gantt_count);
-void sjf_with_memory(Process processes[], int n, GanttEntry gantt[], int *gantt_count, 
+void sjf_schedule(ProcessTable *processes, GanttSink *gantt);
+void sjf_with_memory(ProcessTable *processes, GanttSink *gantt,
                      MemoryManager *mm, AllocationAlgorithm alloc_alg, PageReplacementAlgorithm page_alg);
-void print_gantt_chart(GanttEntry gantt[], int gantt_count);
-void print_scheduling_results(Process processes[], int n);
-
-// Memory management functions
-void init_memory_manager(MemoryManager *mm);
-void cleanup_memory_manager(MemoryManager *mm);
-bool allocate_memory_contiguous(MemoryManager *mm, Process *process, AllocationAlgorithm algorithm);
-void deallocate_memory_contiguous(MemoryManager *mm, Process *process);
-bool allocate_pages(MemoryManager *mm, Process *process, PageReplacementAlgorithm algorithm);
-void deallocate_pages(MemoryManager *mm, Process *process);
-void print_memory_status(MemoryManager *mm, Process processes[], int n);
-int find_lru_page(MemoryManager *mm);
-void access_page(MemoryManager *mm, int frame_index);
 
 #endif // SJF_H
@@ -16,550 +16,120 @@
 #include "sjf.h"
 
 /**
- * Read process data from file
- * Format: PID Arrival_Time Burst_Time Priority
- */
-int read_processes_from_file(const char *filename, Process processes[]) {
-    FILE *file = fopen(filename, "r");
-    if (file == NULL) {
-        printf("Error: Could not open file '%s'\n", filename);
-        return 0;
-    }
-
-    // Skip header line
-    char buffer[256];
-    fgets(buffer, sizeof(buffer), file);
-
-    int count = 0;
-    int priority; // Read but not used in SJF
-
-    // Read each process line
-    while (fscanf(file, "%d %d %d %d", &processes[count].id, &processes[count].arrival_time, 
-                  &processes[count].burst_time, &priority) == 4) {
-        
-        // Initialize process status
-        processes[count].is_completed = false;
-        
-        // Initialize memory fields
-        processes[count].memory_size = 50 + (processes[count].id * 20);
-        processes[count].allocated_address = -1;
-        processes[count].pages_needed = (processes[count].memory_size + PAGE_SIZE - 1) / PAGE_SIZE;
-        
-        // Clear page table
-        for (int j = 0; j < MAX_PROCESS_PAGES; j++) {
-            processes[count].page_table[j] = -1;
-        }
-
-        count++;
-        if (count >= MAX_PROCESSES) {
-            printf("Warning: Reached max process limit\n");
-            break;
-        }
-    }
-
-    fclose(file);
-    return count;
+ * Heap ordering: shorter burst first, then earlier arrival, then lower index
+ */
+static bool runs_before(const ProcessTable *processes, int a, int b) {
+    if (processes->burst_time[a] != processes->burst_time[b])
+        return processes->burst_time[a] < processes->burst_time[b];
+    if (processes->arrival_time[a] != processes->arrival_time[b])
+        return processes->arrival_time[a] < processes->arrival_time[b];
+    return a < b;
 }
 
 /**
- * SJF scheduling algorithm (non-preemptive)
- * Selects shortest burst time process that's ready to run
+ * Add a process to the ready queue
  */
-void sjf_schedule(Process processes[], int n, GanttEntry gantt[], int *gantt_count) {
-    if (n <= 0) return;
-    
-    int current_time = 0;
-    int completed_processes = 0;
-    *gantt_count = 0;
+static void ready_queue_push(SjfQueue *queue, const ProcessTable *processes, int index) {
+    int child = queue->size++;
 
-    while (completed_processes < n) {
-        int shortest_job_index = -1;
-        int shortest_burst = INT_MAX;
-
-        // Find shortest job ready to run
-        for (int i = 0; i < n; i++) {
-            if (processes[i].arrival_time <= current_time && !processes[i].is_completed) {
-                // Select shorter burst time, break ties by arrival time
-                if (processes[i].burst_time < shortest_burst ||
-                    (processes[i].burst_time == shortest_burst &&
-                     processes[i].arrival_time < processes[shortest_job_index].arrival_time)) {
-                    shortest_burst = processes[i].burst_time;
-                    shortest_job_index = i;
-                }
-            }
-        }
-
-        // Execute selected process
-        if (shortest_job_index != -1) {
-            Process *p = &processes[shortest_job_index];
-
-            // Record gantt entry
-            gantt[*gantt_count].process_id = p->id;
-            gantt[*gantt_count].start_time = current_time;
-            gantt[*gantt_count].end_time = current_time + p->burst_time;
-            (*gantt_count)++;
-
-            // Execute process
-            current_time += p->burst_time;
-
-            // Calculate metrics
-            p->completion_time = current_time;
-            p->turnaround_time = p->completion_time - p->arrival_time;
-            p->waiting_time = p->turnaround_time - p->burst_time;
-            p->is_completed = true;
-            completed_processes++;
-        } else {
-            // Find next arrival time
-            int next_arrival = INT_MAX;
-            for (int i = 0; i < n; i++) {
-                if (!processes[i].is_completed && processes[i].arrival_time > current_time) {
-                    if (processes[i].arrival_time < next_arrival) {
-                        next_arrival = processes[i].arrival_time;
-                    }
-                }
-            }
-            current_time = (next_arrival != INT_MAX) ? next_arrival : current_time + 1;
-        }
+    // Sift up
+    while (child > 0) {
+        int parent = (child - 1) / 2;
+        if (!runs_before(processes, index, queue->heap[parent])) break;
+        queue->heap[child] = queue->heap[parent];
+        child = parent;
     }
+    queue->heap[child] = index;
 }
 
 /**
- * SJF with memory management integration
+ * Remove and return the next process to run
  */
-void sjf_with_memory(Process processes[], int n, GanttEntry gantt[], int *gantt_count, 
-                     MemoryManager *mm, AllocationAlgorithm alloc_alg, PageReplacementAlgorithm page_alg) {
-    if (n <= 0) return;
-    
-    int current_time = 0;
-    int completed_processes = 0;
-    *gantt_count = 0;
-
-    while (completed_processes < n) {
-        int shortest_job_index = -1;
-        int shortest_burst = INT_MAX;
-
-        // Find shortest job ready to run
-        for (int i = 0; i < n; i++) {
-            if (processes[i].arrival_time <= current_time && !processes[i].is_completed) {
-                if (processes[i].burst_time < shortest_burst ||
-                    (processes[i].burst_time == shortest_burst &&
-                     processes[i].arrival_time < processes[shortest_job_index].arrival_time)) {
-                    shortest_burst = processes[i].burst_time;
-                    shortest_job_index = i;
-                }
-            }
-        }
-
-        if (shortest_job_index != -1) {
-            Process *p = &processes[shortest_job_index];
-
-            // Allocate memory
-            bool contiguous_allocated = allocate_memory_contiguous(mm, p, alloc_alg);
-            bool pages_allocated = allocate_pages(mm, p, page_alg);
-            
-            if (!contiguous_allocated) {
-                printf("Warning: Could not allocate contiguous memory for Process P%d\n", p->id);
-            }
-            if (!pages_allocated) {
-                printf("Warning: Could not allocate pages for Process P%d\n", p->id);
-            }
-
-            // Record gantt entry
-            gantt[*gantt_count].process_id = p->id;
-            gantt[*gantt_count].start_time = current_time;
-            gantt[*gantt_count].end_time = current_time + p->burst_time;
-            (*gantt_count)++;
+static int ready_queue_pop(SjfQueue *queue, const ProcessTable *processes) {
+    int top = queue->heap[0];
+    int last = queue->heap[--queue->size];
+    int parent = 0;
 
-            // Simulate memory access during execution
-            for (int access = 0; access < p->pages_needed; access++) {
-                if (p->page_table[access] != -1) {
-                    access_page(mm, p->page_table[access]);
-                }
-            }
-
-            // Execute process
-            current_time += p->burst_time;
-
-            // Calculate metrics
-            p->completion_time = current_time;
-            p->turnaround_time = p->completion_time - p->arrival_time;
-            p->waiting_time = p->turnaround_time - p->burst_time;
-            p->is_completed = true;
-            completed_processes++;
-            
-            // Deallocate memory
-            deallocate_memory_contiguous(mm, p);
-            deallocate_pages(mm, p);
-        } else {
-            // Find next arrival time
-            int next_arrival = INT_MAX;
-            for (int i = 0; i < n; i++) {
-                if (!processes[i].is_completed && processes[i].arrival_time > current_time) {
-                    if (processes[i].arrival_time < next_arrival) {
-                        next_arrival = processes[i].arrival_time;
-                    }
-                }
-            }
-            current_time = (next_arrival != INT_MAX) ? next_arrival : current_time + 1;
+    // Sift down
+    while (2 * parent + 1 < queue->size) {
+        int child = 2 * parent + 1;
+        if (child + 1 < queue->size && runs_before(processes, queue->heap[child + 1], queue->heap[child])) {
+            child++;
         }
+        if (!runs_before(processes, queue->heap[child], last)) break;
+        queue->heap[parent] = queue->heap[child];
+        parent = child;
     }
-}
+    queue->heap[parent] = last;
 
-/**
- * Print gantt chart
- */
-void print_gantt_chart(GanttEntry gantt[], int gantt_count) {
-    printf("\nGantt Chart:\n");
-    printf("|");
-    for (int i = 0; i < gantt_count; i++) {
-        printf(" P%d |", gantt[i].process_id);
-    }
-    printf("\n");
-    printf("%d", gantt[0].start_time);
-    for (int i = 0; i < gantt_count; i++) {
-        printf("    %d", gantt[i].end_time);
-    }
-    printf("\n\n");
+    return top;
 }
 
 /**
- * Print scheduling results
+ * Policy: a newly arrived process joins the ready heap
  */
-void print_scheduling_results(Process processes[], int n) {
-    int total_waiting_time = 0;
-    int total_turnaround_time = 0;
-
-    printf("Process Statistics:\n");
-    printf("PID\tArrival\tBurst\tWaiting\tTurnaround\n");
-    printf("---\t-------\t-----\t-------\t----------\n");
-
-    for (int i = 0; i < n; i++) {
-        printf("%d\t%d\t%d\t%d\t%d\n",
-               processes[i].id,
-               processes[i].arrival_time,
-               processes[i].burst_time,
-               processes[i].waiting_time,
-               processes[i].turnaround_time);
-
-        total_waiting_time += processes[i].waiting_time;
-        total_turnaround_time += processes[i].turnaround_time;
-    }
-
-    printf("\nAverage Waiting Time:    %.2f\n", (double)total_waiting_time / n);
-    printf("Average Turnaround Time: %.2f\n", (double)total_turnaround_time / n);
+static void sjf_admit(Simulation *sim, int p) {
+    ready_queue_push((SjfQueue *)sim->state, sim->processes, p);
 }
 
 /**
- * Initialize memory manager
+ * Policy: run the shortest ready job
  */
-void init_memory_manager(MemoryManager *mm) {
-    // Initialize contiguous memory as one large free block
-    mm->memory_blocks = (MemoryBlock *)malloc(sizeof(MemoryBlock));
-    mm->memory_blocks->start_address = 0;
-    mm->memory_blocks->size = MEMORY_SIZE;
-    mm->memory_blocks->process_id = -1; // Free
-    mm->memory_blocks->next = NULL;
-
-    // Initialize page frames
-    for (int i = 0; i < NUM_PAGES; i++) {
-        mm->page_frames[i].process_id = -1;
-        mm->page_frames[i].page_number = -1;
-        mm->page_frames[i].last_access_time = 0;
-    }
-
-    // Initialize FIFO queue
-    mm->fifo_front = 0;
-    mm->fifo_rear = 0;
-    mm->current_time = 0;
+static int sjf_select(Simulation *sim) {
+    SjfQueue *ready = (SjfQueue *)sim->state;
+    return (ready->size > 0) ? ready_queue_pop(ready, sim->processes) : -1;
 }
 
 /**
- * Cleanup memory manager
+ * Policy: non-preemptive, so a job runs to completion
  */
-void cleanup_memory_manager(MemoryManager *mm) {
-    MemoryBlock *current = mm->memory_blocks;
-    while (current != NULL) {
-        MemoryBlock *next = current->next;
-        free(current);
-        current = next;
-    }
+static int sjf_slice(Simulation *sim, int p) {
+    return sim->processes->remaining_time[p];
 }
 
 /**
- * Allocate contiguous memory using specified algorithm
+ * Policy: nothing to requeue when a job finishes
  */
-bool allocate_memory_contiguous(MemoryManager *mm, Process *process, AllocationAlgorithm algorithm) {
-    MemoryBlock *best_block = NULL;
-    MemoryBlock *current = mm->memory_blocks;
-
-    // Find suitable block based on algorithm
-    while (current != NULL) {
-        if (current->process_id == -1 && current->size >= process->memory_size) {
-            if (algorithm == FIRST_FIT) {
-                best_block = current;
-                break;
-            } else if (algorithm == BEST_FIT) {
-                if (best_block == NULL || current->size < best_block->size) {
-                    best_block = current;
-                }
-            } else if (algorithm == WORST_FIT) {
-                if (best_block == NULL || current->size > best_block->size) {
-                    best_block = current;
-                }
-            }
-        }
-        current = current->next;
-    }
-
-    if (best_block == NULL) return false;
-
-    // Allocate the block
-    process->allocated_address = best_block->start_address;
-    best_block->process_id = process->id;
-
-    // Split block if larger than needed
-    if (best_block->size > process->memory_size) {
-        MemoryBlock *new_block = (MemoryBlock *)malloc(sizeof(MemoryBlock));
-        new_block->start_address = best_block->start_address + process->memory_size;
-        new_block->size = best_block->size - process->memory_size;
-        new_block->process_id = -1; // Free
-        new_block->next = best_block->next;
-        
-        best_block->size = process->memory_size;
-        best_block->next = new_block;
-    }
-
-    return true;
+static void sjf_slice_end(Simulation *sim, int p, bool completed) {
+    (void)sim;
+    (void)p;
+    (void)completed;
 }
 
-/**
- * Deallocate contiguous memory
- */
-void deallocate_memory_contiguous(MemoryManager *mm, Process *process) {
-    if (process->allocated_address == -1) return;
-
-    MemoryBlock *current = mm->memory_blocks;
-    MemoryBlock *prev = NULL;
-
-    // Find block to deallocate
-    while (current != NULL) {
-        if (current->start_address == process->allocated_address && current->process_id == process->id) {
-            current->process_id = -1; // Mark as free
-            
-            // Merge with next block if free
-            if (current->next != NULL && current->next->process_id == -1) {
-                MemoryBlock *next_block = current->next;
-                current->size += next_block->size;
-                current->next = next_block->next;
-                free(next_block);
-            }
-            
-            // Merge with previous block if free
-            if (prev != NULL && prev->process_id == -1) {
-                prev->size += current->size;
-                prev->next = current->next;
-                free(current);
-            }
-            
-            break;
-        }
-        prev = current;
-        current = current->next;
-    }
-
-    process->allocated_address = -1;
-}
+static const SimPolicy sjf_policy = { sjf_admit, sjf_select, sjf_slice, sjf_slice_end };
 
 /**
- * Allocate pages using specified page replacement algorithm
+ * Run SJF on the simulation engine, with or without memory management
  */
-bool allocate_pages(MemoryManager *mm, Process *process, PageReplacementAlgorithm algorithm) {
-    int allocated_pages = 0;
-    
-    for (int page = 0; page < process->pages_needed; page++) {
-        int free_frame = -1;
-        
-        // Find free frame
-        for (int i = 0; i < NUM_PAGES; i++) {
-            if (mm->page_frames[i].process_id == -1) {
-                free_frame = i;
-                break;
-            }
-        }
-        
-        // Use page replacement if no free frame
-        if (free_frame == -1) {
-            if (algorithm == FIFO) {
-                free_frame = mm->fifo_queue[mm->fifo_front];
-                mm->fifo_front = (mm->fifo_front + 1) % NUM_PAGES;
-            } else if (algorithm == LRU) {
-                free_frame = find_lru_page(mm);
-            }
-        }
-        
-        // Allocate frame
-        mm->page_frames[free_frame].process_id = process->id;
-        mm->page_frames[free_frame].page_number = page;
-        mm->page_frames[free_frame].last_access_time = mm->current_time++;
-        
-        process->page_table[page] = free_frame;
-        
-        // Add to FIFO queue if new allocation
-        if (algorithm == FIFO) {
-            mm->fifo_queue[mm->fifo_rear] = free_frame;
-            mm->fifo_rear = (mm->fifo_rear + 1) % NUM_PAGES;
-        }
-        
-        allocated_pages++;
-    }
-    
-    return allocated_pages == process->pages_needed;
-}
+static void sjf_run(ProcessTable *processes, GanttSink *gantt,
+                    MemoryManager *mm, AllocationAlgorithm alloc_alg, PageReplacementAlgorithm page_alg) {
+    int n = processes->count;
+    if (n <= 0) return;
 
-/**
- * Deallocate pages
- */
-void deallocate_pages(MemoryManager *mm, Process *process) {
-    for (int page = 0; page < process->pages_needed; page++) {
-        int frame = process->page_table[page];
-        if (frame != -1) {
-            mm->page_frames[frame].process_id = -1;
-            mm->page_frames[frame].page_number = -1;
-            mm->page_frames[frame].last_access_time = 0;
-            process->page_table[page] = -1;
-        }
+    SjfQueue ready = { (int *)malloc(n * sizeof(int)), 0 };
+    Simulation sim;
+    sim_init(&sim, processes, gantt, &sjf_policy, &ready);
+    if (mm != NULL) {
+        sim_use_memory(&sim, mm, alloc_alg, page_alg, false);
     }
-}
+    sim_run(&sim);
 
-/**
- * Find LRU page for replacement
- */
-int find_lru_page(MemoryManager *mm) {
-    int lru_frame = 0;
-    int min_time = mm->page_frames[0].last_access_time;
-    
-    for (int i = 1; i < NUM_PAGES; i++) {
-        if (mm->page_frames[i].last_access_time < min_time) {
-            min_time = mm->page_frames[i].last_access_time;
-            lru_frame = i;
-        }
-    }
-    
-    return lru_frame;
+    sim_free(&sim);
+    free(ready.heap);
 }
 
 /**
- * Access a page (update LRU time)
+ * SJF scheduling algorithm (non-preemptive)
+ * Selects shortest burst time process that's ready to run
  */
-void access_page(MemoryManager *mm, int frame_index) {
-    if (frame_index >= 0 && frame_index < NUM_PAGES) {
-        mm->page_frames[frame_index].last_access_time = mm->current_time++;
-    }
+void sjf_schedule(ProcessTable *processes, GanttSink *gantt) {
+    sjf_run(processes, gantt, NULL, FIRST_FIT, FIFO);
 }
 
 /**
- * Print memory status
+ * SJF with memory management integration
  */
-void print_memory_status(MemoryManager *mm, Process processes[], int n) {
-    printf("\n---Memory Management Status---\n");
-    
-    // Print contiguous memory allocation
-    printf("\nContiguous Memory Allocation:\n");
-    printf("Address\tSize\tProcess\tStatus\n");
-    MemoryBlock *current = mm->memory_blocks;
-    while (current != NULL) {
-        printf("%d\t%d\t%s\t%s\n", 
-               current->start_address, 
-               current->size,
-               current->process_id == -1 ? "N/A" : "",
-               current->process_id == -1 ? "FREE" : "ALLOCATED");
-        if (current->process_id != -1) {
-            printf("\t\tP%d\t\n", current->process_id);
-        }
-        current = current->next;
-    }
-    
-    // Print page allocation
-    printf("\nPage Allocation:\n");
-    printf("Frame\tProcess\tPage\tLast Access\n");
-    for (int i = 0; i < NUM_PAGES; i++) {
-        if (mm->page_frames[i].process_id != -1) {
-            printf("%d\tP%d\t%d\t%d\n", 
-                   i, 
-                   mm->page_frames[i].process_id,
-                   mm->page_frames[i].page_number,
-                   mm->page_frames[i].last_access_time);
-        }
-    }
-    
-    // Print process memory information
-    printf("\nProcess Memory Information:\n");
-    printf("PID\tMemory Size\tPages Needed\tContiguous Addr\tPage Allocation\n");
-    for (int i = 0; i < n; i++) {
-        printf("%d\t%d\t\t%d\t\t%d\t\t", 
-               processes[i].id,
-               processes[i].memory_size,
-               processes[i].pages_needed,
-               processes[i].allocated_address);
-        
-        for (int j = 0; j < processes[i].pages_needed; j++) {
-            if (processes[i].page_table[j] != -1)
-                printf("F%d ", processes[i].page_table[j]);
-        }
-        printf("\n");
-    }
-    printf("\n");
+void sjf_with_memory(ProcessTable *processes, GanttSink *gantt, 
+                     MemoryManager *mm, AllocationAlgorithm alloc_alg, PageReplacementAlgorithm page_alg) {
+    sjf_run(processes, gantt, mm, alloc_alg, page_alg);
 }
-
-/**
- * Main function
- */
-int main() {
-    Process processes[MAX_PROCESSES];
-    GanttEntry gantt[MAX_GANTT_ENTRIES];
-    MemoryManager mm;
-    int n, gantt_count;
-
-    // Initialize memory manager
-    init_memory_manager(&mm);
-
-    // Read process data
-    n = read_processes_from_file("processes.txt", processes);
-    if (n == 0) {
-        cleanup_memory_manager(&mm);
-        return 1;
-    }
-
-    printf("---Shortest Job First (SJF) Scheduling with Memory Management---\n");
-    printf("Memory Size: %d bytes, Page Size: %d bytes, Number of Pages: %d\n\n", 
-           MEMORY_SIZE, PAGE_SIZE, NUM_PAGES);
-
-    // Test different allocation algorithms
-    printf("---Testing First-Fit Contiguous Allocation with FIFO Paging---\n");
-    sjf_with_memory(processes, n, gantt, &gantt_count, &mm, FIRST_FIT, FIFO);
-    print_gantt_chart(gantt, gantt_count);
-    print_scheduling_results(processes, n);
-    print_memory_status(&mm, processes, n);
-
-    // Reset for next test
-    cleanup_memory_manager(&mm);
-    init_memory_manager(&mm);
-    
-    // Reset process status
-    for (int i = 0; i < n; i++) {
-        processes[i].allocated_address = -1;
-        for (int j = 0; j < MAX_PROCESS_PAGES; j++) {
-            processes[i].page_table[j] = -1;
-        }
-        processes[i].is_completed = false;
-    }
-
-    printf("\n---Testing Best-Fit Contiguous Allocation with LRU Paging---\n");
-    sjf_with_memory(processes, n, gantt, &gantt_count, &mm, BEST_FIT, LRU);
-    print_gantt_chart(gantt, gantt_count);
-    print_scheduling_results(processes, n);
-    print_memory_status(&mm, processes, n);
-
-    cleanup_memory_manager(&mm);
-    return 0;
-}
\ No newline at end of file
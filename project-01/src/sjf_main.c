@@ -0,0 +1,80 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Shortest Job First (SJF) driver program
+
+ * Usage: ./sjf_1 [trace] [memory_size] [page_size] [max_pages]
+ * Sizes take a K, M, G or T suffix (256G, 2M); max_pages is the page table size per process.
+ * Runs SJF with First-Fit/FIFO and then Best-Fit/LRU memory management.
+ */
+
+#include "sjf.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const char *filename = (argc > 1) ? argv[1] : "processes.txt";
+    long long memory_size = (argc > 2) ? parse_memory_size(argv[2], NULL) : MEMORY_SIZE;
+    long long page_size = (argc > 3) ? parse_memory_size(argv[3], NULL) : PAGE_SIZE;
+    int max_pages = (argc > 4) ? atoi(argv[4]) : MAX_PROCESS_PAGES;
+    Arena arena;
+    ProcessTable processes;
+    GanttTextSink gantt;
+    MemoryManager mm;
+    int n;
+
+    if (!check_memory_config(memory_size, page_size)) {
+        return 1;
+    }
+
+    // All process storage comes from one arena; the chart is printed as it is produced
+    arena_init(&arena);
+    gantt_text_sink_init(&gantt, stdout);
+
+    // Initialize memory manager
+    init_memory_manager(&mm, memory_size, (int)page_size);
+
+    // Read process data
+    n = read_processes_from_file(filename, &arena, &processes);
+    if (n == 0) {
+        cleanup_memory_manager(&mm);
+        arena_free(&arena);
+        return 1;
+    }
+    if (max_pages != MAX_PROCESS_PAGES && !process_table_set_max_pages(&processes, &arena, max_pages)) {
+        cleanup_memory_manager(&mm);
+        arena_free(&arena);
+        return 1;
+    }
+    process_table_set_page_size(&processes, (int)page_size);
+
+    printf("---Shortest Job First (SJF) Scheduling with Memory Management---\n");
+    printf("Memory Size: %lld bytes, Page Size: %d bytes, Number of Pages: %d\n\n", 
+           mm.memory_size, mm.page_size, mm.num_pages);
+
+    // Test different allocation algorithms
+    printf("---Testing First-Fit Contiguous Allocation with FIFO Paging---\n");
+    sjf_with_memory(&processes, &gantt.sink, &mm, FIRST_FIT, FIFO);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+    print_memory_status(&mm, &processes);
+
+    // Reset for next test
+    reset_memory_manager(&mm);
+    
+    // Reset process status
+    process_table_reset(&processes);
+
+    printf("\n---Testing Best-Fit Contiguous Allocation with LRU Paging---\n");
+    sjf_with_memory(&processes, &gantt.sink, &mm, BEST_FIT, LRU);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+    print_memory_status(&mm, &processes);
+
+    cleanup_memory_manager(&mm);
+    arena_free(&arena);
+    return 0;
+}
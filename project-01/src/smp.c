@@ -0,0 +1,368 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Multi-CPU (SMP) Round Robin scheduling with work stealing
+
+ * K simulated cores each run round robin on their own run queue. Arrivals are handed
+ * to the cores in turn (the i-th arrival goes to core i mod K). Every balance_interval
+ * time units the cores stop at a balance point, where each core with an empty run queue
+ * steals half of the queued work from the back of the longest queue. Stolen processes
+ * count as migrations.
+
+ * Between balance points the cores share no state, so each epoch is simulated on host
+ * threads (one block of cores per thread) and the threads meet at a barrier where one
+ * of them does the stealing. The result is the same for any number of host threads.
+
+ * Input: processes.txt containing process information in format: process_id arrival_time burst_time
+ * Output: Per-core Gantt charts, waiting and turnaround times, per-core utilization and migrations
+ */
+
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "smp.h"
+
+// State shared by the host threads simulating the cores
+typedef struct {
+    ProcessTable *processes;
+    const int *arrival_order;
+    SmpCore *cores;
+    const SmpConfig *config;
+    pthread_barrier_t barrier;
+    int epoch_end;
+    bool done;
+} SmpShared;
+
+// One host thread simulates cores [first_core, last_core)
+typedef struct {
+    SmpShared *shared;
+    int first_core;
+    int last_core;
+} SmpWorker;
+
+/**
+ * Default configuration: SMP_CORES cores, round robin quantum SMP_TIME_QUANTUM
+ */
+void smp_default_config(SmpConfig *config) {
+    config->num_cores = SMP_CORES;
+    config->quantum = SMP_TIME_QUANTUM;
+    config->balance_interval = SMP_BALANCE_INTERVAL;
+    config->num_threads = 0;
+}
+
+/**
+ * Allocate cores, each with its own arena for its Gantt chart
+ */
+SmpCore *smp_create_cores(int num_cores) {
+    SmpCore *cores = (SmpCore *)calloc(num_cores, sizeof(SmpCore));
+    for (int c = 0; c < num_cores; c++) {
+        arena_init(&cores[c].arena);
+        gantt_init(&cores[c].gantt, &cores[c].arena);
+    }
+    return cores;
+}
+
+/**
+ * Free cores created by smp_create_cores
+ */
+void smp_free_cores(SmpCore cores[], int num_cores) {
+    for (int c = 0; c < num_cores; c++) {
+        free(cores[c].queue.items);
+        arena_free(&cores[c].arena);
+    }
+    free(cores);
+}
+
+/**
+ * Add a process to the back of a deque, growing it when full
+ */
+static void deque_push_back(SmpDeque *deque, int index) {
+    if (deque->count == deque->capacity) {
+        int new_capacity = (deque->capacity < 16) ? 16 : deque->capacity * 2;
+        int *items = (int *)malloc(new_capacity * sizeof(int));
+        for (int i = 0; i < deque->count; i++) {
+            items[i] = deque->items[(deque->front + i) % deque->capacity];
+        }
+        free(deque->items);
+        deque->items = items;
+        deque->capacity = new_capacity;
+        deque->front = 0;
+    }
+    deque->items[(deque->front + deque->count) % deque->capacity] = index;
+    deque->count++;
+}
+
+/**
+ * Remove the process at the front of a deque (owner side)
+ */
+static int deque_pop_front(SmpDeque *deque) {
+    int index = deque->items[deque->front];
+    deque->front = (deque->front + 1) % deque->capacity;
+    deque->count--;
+    return index;
+}
+
+/**
+ * Move every process handed to this core that has arrived by its current time into its queue
+ */
+static void admit_core_arrivals(SmpShared *shared, SmpCore *core) {
+    const ProcessTable *processes = shared->processes;
+    while (core->next_arrival < processes->count &&
+           processes->arrival_time[shared->arrival_order[core->next_arrival]] <= core->current_time) {
+        deque_push_back(&core->queue, shared->arrival_order[core->next_arrival]);
+        core->next_arrival += shared->config->num_cores;
+    }
+}
+
+/**
+ * Run one core's round robin until its clock reaches the end of the epoch
+ * A slice that starts before the balance point is allowed to finish past it.
+ */
+static void run_core_epoch(SmpShared *shared, SmpCore *core) {
+    ProcessTable *processes = shared->processes;
+    int *remaining_time = processes->remaining_time;
+    int quantum = shared->config->quantum;
+    core->stealable = -1;
+
+    while (core->current_time < shared->epoch_end) {
+        admit_core_arrivals(shared, core);
+
+        // Idle until the next arrival, or until the balance point if none comes before it
+        if (core->queue.count == 0) {
+            int next_time = shared->epoch_end;
+            if (core->next_arrival < processes->count) {
+                int arrival = processes->arrival_time[shared->arrival_order[core->next_arrival]];
+                if (arrival < next_time) next_time = arrival;
+            }
+            core->current_time = next_time;
+            continue;
+        }
+
+        int p = deque_pop_front(&core->queue);
+        int execution_time = (remaining_time[p] > quantum) ? quantum : remaining_time[p];
+        record_dispatch(processes, p, core->current_time);
+        gantt_add(&core->gantt.sink, processes->id[p], core->current_time, core->current_time + execution_time);
+        core->current_time += execution_time;
+        core->last_end = core->current_time;
+        core->busy_time += execution_time;
+        core->slices++;
+        remaining_time[p] -= execution_time;
+
+        // Processes queued after a slice that crosses the balance point are not there yet at it
+        if (core->current_time >= shared->epoch_end) {
+            core->stealable = core->queue.count;
+        }
+
+        // Newly arrived processes queue ahead of the preempted one
+        admit_core_arrivals(shared, core);
+
+        if (remaining_time[p] == 0) {
+            record_completion_into(processes, p, core->current_time, &core->metrics);
+            core->completed++;
+        } else {
+            deque_push_back(&core->queue, p);
+        }
+    }
+    if (core->stealable == -1) {
+        core->stealable = core->queue.count;
+    }
+}
+
+/**
+ * Balance point: idle cores steal from the longest run queues, then pick the next epoch
+ * Runs on one thread while the others wait at the barrier.
+ */
+static void balance_cores(SmpShared *shared) {
+    SmpCore *cores = shared->cores;
+    int num_cores = shared->config->num_cores;
+    int interval = (shared->config->balance_interval > 0) ? shared->config->balance_interval : 1;
+    int n = shared->processes->count;
+
+    int completed = 0;
+    for (int c = 0; c < num_cores; c++) {
+        completed += cores[c].completed;
+    }
+    if (completed == n) {
+        shared->done = true;
+        return;
+    }
+
+    bool any_queued = false;
+    for (int thief = 0; thief < num_cores; thief++) {
+        if (cores[thief].queue.count > 0) {
+            any_queued = true;
+            continue;
+        }
+
+        // Victim: the most processes waiting at the balance point, lowest core number on ties
+        int victim = -1;
+        for (int c = 0; c < num_cores; c++) {
+            if (c != thief && (victim == -1 || cores[c].stealable > cores[victim].stealable)) {
+                victim = c;
+            }
+        }
+        if (victim == -1) continue;
+
+        // Take half of them, rounding up if the victim is still busy with a slice
+        SmpCore *from = &cores[victim];
+        bool victim_busy = from->current_time > shared->epoch_end;
+        int steal = victim_busy ? (from->stealable + 1) / 2 : from->stealable / 2;
+        if (steal == 0) continue;
+
+        // Stolen processes keep their relative order at the back of the thief's queue
+        SmpDeque *deque = &from->queue;
+        int first = from->stealable - steal;
+        for (int i = first; i < from->stealable; i++) {
+            deque_push_back(&cores[thief].queue, deque->items[(deque->front + i) % deque->capacity]);
+        }
+
+        // Close the gap left behind by the processes queued after the balance point
+        for (int i = from->stealable; i < deque->count; i++) {
+            deque->items[(deque->front + i - steal) % deque->capacity] = deque->items[(deque->front + i) % deque->capacity];
+        }
+        deque->count -= steal;
+        from->stealable -= steal;
+        cores[thief].stealable = cores[thief].queue.count;
+        cores[victim].migrations_out += steal;
+        cores[thief].migrations_in += steal;
+        any_queued = true;
+    }
+
+    // With no queued work and no slice running past the balance point, skip to the next arrival
+    int next_end = shared->epoch_end + interval;
+    if (!any_queued) {
+        int next_time = -1;
+        for (int c = 0; c < num_cores; c++) {
+            int time = cores[c].current_time;
+            if (time <= shared->epoch_end) {
+                if (cores[c].next_arrival >= n) continue;
+                time = shared->processes->arrival_time[shared->arrival_order[cores[c].next_arrival]];
+            }
+            if (next_time == -1 || time < next_time) next_time = time;
+        }
+        if (next_time >= next_end) {
+            next_end = (next_time / interval + 1) * interval;
+        }
+    }
+    shared->epoch_end = next_end;
+}
+
+/**
+ * Host thread: simulate a block of cores one epoch at a time
+ */
+static void *smp_worker(void *arg) {
+    SmpWorker *worker = (SmpWorker *)arg;
+    SmpShared *shared = worker->shared;
+
+    while (true) {
+        for (int c = worker->first_core; c < worker->last_core; c++) {
+            run_core_epoch(shared, &shared->cores[c]);
+        }
+        if (pthread_barrier_wait(&shared->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+            balance_cores(shared);
+        }
+        pthread_barrier_wait(&shared->barrier);
+        if (shared->done) break;
+    }
+    return NULL;
+}
+
+/**
+ * SMP Round Robin scheduling with work stealing
+ * Returns the makespan (end of the last slice on any core).
+ */
+int smp_schedule(ProcessTable *processes, SmpCore cores[], const SmpConfig *config) {
+    int n = processes->count;
+    int num_cores = config->num_cores;
+    if (n <= 0 || num_cores <= 0) return 0;
+
+    int *arrival_order = (int *)malloc(n * sizeof(int));
+    sort_by_arrival(processes, arrival_order);
+
+    for (int c = 0; c < num_cores; c++) {
+        SmpCore *core = &cores[c];
+        core->queue.front = 0;
+        core->queue.count = 0;
+        gantt_clear(&core->gantt);
+        core->current_time = 0;
+        core->next_arrival = c;
+        core->completed = 0;
+        core->last_end = 0;
+        core->busy_time = 0;
+        core->slices = 0;
+        core->migrations_in = 0;
+        core->migrations_out = 0;
+        process_metrics_init(&core->metrics);
+    }
+
+    // Host threads: one per online CPU for large traces, never more than the cores
+    int num_threads = config->num_threads;
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (n < SMP_PARALLEL_MIN_PROCESSES || cpus < 1) ? 1 : (int)cpus;
+    }
+    if (num_threads > num_cores) num_threads = num_cores;
+
+    SmpShared shared;
+    shared.processes = processes;
+    shared.arrival_order = arrival_order;
+    shared.cores = cores;
+    shared.config = config;
+    shared.epoch_end = (config->balance_interval > 0) ? config->balance_interval : 1;
+    shared.done = false;
+    pthread_barrier_init(&shared.barrier, NULL, num_threads);
+
+    // The calling thread simulates the first block of cores itself
+    SmpWorker *workers = (SmpWorker *)malloc(num_threads * sizeof(SmpWorker));
+    pthread_t *threads = (pthread_t *)malloc(num_threads * sizeof(pthread_t));
+    for (int t = 0; t < num_threads; t++) {
+        workers[t].shared = &shared;
+        workers[t].first_core = (int)((long long)num_cores * t / num_threads);
+        workers[t].last_core = (int)((long long)num_cores * (t + 1) / num_threads);
+    }
+    for (int t = 1; t < num_threads; t++) {
+        pthread_create(&threads[t], NULL, smp_worker, &workers[t]);
+    }
+    smp_worker(&workers[0]);
+    for (int t = 1; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_barrier_destroy(&shared.barrier);
+
+    // Each core recorded its own completions; combine them
+    int makespan = 0;
+    for (int c = 0; c < num_cores; c++) {
+        if (cores[c].last_end > makespan) makespan = cores[c].last_end;
+        process_metrics_merge(processes->metrics, &cores[c].metrics);
+    }
+
+    free(workers);
+    free(threads);
+    free(arrival_order);
+    return makespan;
+}
+
+/**
+ * Print per-core utilization and migration counts
+ */
+void print_smp_core_stats(const SmpCore cores[], int num_cores, int makespan) {
+    long long total_busy = 0;
+    long long total_migrations = 0;
+
+    printf("Core Statistics (makespan %d):\n", makespan);
+    printf("Core\tBusy\tUtil%%\tSlices\tMigrIn\tMigrOut\n");
+    printf("----\t----\t-----\t------\t------\t-------\n");
+    for (int c = 0; c < num_cores; c++) {
+        double utilization = (makespan > 0) ? 100.0 * cores[c].busy_time / makespan : 0.0;
+        printf("%d\t%lld\t%.1f\t%d\t%d\t%d\n", c, cores[c].busy_time, utilization,
+               cores[c].slices, cores[c].migrations_in, cores[c].migrations_out);
+        total_busy += cores[c].busy_time;
+        total_migrations += cores[c].migrations_in;
+    }
+
+    double average = (makespan > 0) ? 100.0 * total_busy / ((double)makespan * num_cores) : 0.0;
+    printf("\nAverage Utilization: %.1f%%\n", average);
+    printf("Total Migrations:    %lld\n", total_migrations);
+}
@@ -0,0 +1,58 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+
+// Constants for multi-CPU (SMP) scheduling
+#define SMP_CORES 4
+#define SMP_TIME_QUANTUM 3
+#define SMP_BALANCE_INTERVAL 10
+#define SMP_PARALLEL_MIN_PROCESSES 100000
+
+// SMP configuration
+typedef struct {
+    int num_cores;
+    int quantum;
+    int balance_interval; // Idle cores steal work every balance_interval time units
+    int num_threads;      // Host threads, 0 or less picks one per online CPU for large traces
+} SmpConfig;
+
+// Per-core run queue: deque of process indices, the owner takes the front and thieves take the back
+typedef struct {
+    int *items;
+    int capacity;
+    int front;
+    int count;
+} SmpDeque;
+
+// One simulated CPU with its own clock, run queue, Gantt chart and statistics
+typedef struct {
+    SmpDeque queue;
+    GanttChart gantt;
+    Arena arena;
+    int current_time;
+    int next_arrival;   // Position in arrival order; core c is handed arrivals c, c + K, c + 2K, ...
+    int completed;
+    int last_end;       // End of the last slice this core ran
+    int stealable;      // Queued processes (from the front) already waiting at the balance point
+    long long busy_time;
+    int slices;
+    int migrations_in;
+    int migrations_out;
+    ProcessMetrics metrics; // Merged into the process table's metrics after the run
+} SmpCore;
+
+// Function declarations
+void smp_default_config(SmpConfig *config);
+SmpCore *smp_create_cores(int num_cores);
+void smp_free_cores(SmpCore cores[], int num_cores);
+int smp_schedule(ProcessTable *processes, SmpCore cores[], const SmpConfig *config);
+void print_smp_core_stats(const SmpCore cores[], int num_cores, int makespan);
+
+#endif // SMP_H
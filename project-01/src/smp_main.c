@@ -0,0 +1,58 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Multi-CPU (SMP) Round Robin driver program
+
+ * Usage: ./smp [trace] [cores] [threads]
+ */
+
+#include "smp.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const char *filename = (argc > 1) ? argv[1] : "processes.txt";
+    Arena arena;
+    ProcessTable processes;
+    SmpConfig config;
+
+    smp_default_config(&config);
+    if (argc > 2) config.num_cores = atoi(argv[2]);
+    if (argc > 3) config.num_threads = atoi(argv[3]);
+    if (config.num_cores <= 0) {
+        printf("Error: Number of cores must be positive\n");
+        return 1;
+    }
+
+    // Read process data
+    arena_init(&arena);
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        arena_free(&arena);
+        return 1;
+    }
+
+    printf("---SMP Round Robin Scheduling (%d Cores, Time Quantum = %d)---\n", config.num_cores, config.quantum);
+    printf("Idle cores steal half of the longest run queue every %d time units\n", config.balance_interval);
+
+    SmpCore *cores = smp_create_cores(config.num_cores);
+    int makespan = smp_schedule(&processes, cores, &config);
+
+    for (int c = 0; c < config.num_cores; c++) {
+        printf("\nCore %d:", c);
+        if (cores[c].gantt.count == 0) {
+            printf(" idle\n");
+            continue;
+        }
+        print_gantt_chart(cores[c].gantt.entries, cores[c].gantt.count);
+    }
+    print_scheduling_results(&processes);
+    printf("\n");
+    print_smp_core_stats(cores, config.num_cores, makespan);
+
+    smp_free_cores(cores, config.num_cores);
+    arena_free(&arena);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Shortest Remaining Time First (SRTF) scheduling algorithm
+
+ * SRTF is the preemptive form of SJF: whenever a process arrives with less remaining
+ * time than the running process, the running process is preempted.
+ * It runs on the simulation engine: a slice ends at the next arrival or at completion,
+ * and the ready processes are kept in a min-heap on remaining_time, so each event is O(log n).
+
+ * Input: processes.txt containing process information in format: process_id arrival_time burst_time
+ * Output: Gantt chart, waiting time, and turnaround time for each process
+ */
+
+#include "srtf.h"
+
+/**
+ * Heap ordering: less remaining time first, then earlier arrival, then lower index
+ */
+static bool runs_before(const ProcessTable *processes, int a, int b) {
+    if (processes->remaining_time[a] != processes->remaining_time[b])
+        return processes->remaining_time[a] < processes->remaining_time[b];
+    if (processes->arrival_time[a] != processes->arrival_time[b])
+        return processes->arrival_time[a] < processes->arrival_time[b];
+    return a < b;
+}
+
+/**
+ * Add a process to the ready queue
+ */
+static void srtf_queue_push(SrtfQueue *queue, const ProcessTable *processes, int index) {
+    int child = queue->size++;
+
+    // Sift up
+    while (child > 0) {
+        int parent = (child - 1) / 2;
+        if (!runs_before(processes, index, queue->heap[parent])) break;
+        queue->heap[child] = queue->heap[parent];
+        child = parent;
+    }
+    queue->heap[child] = index;
+}
+
+/**
+ * Remove the process with the least remaining time
+ */
+static void srtf_queue_pop(SrtfQueue *queue, const ProcessTable *processes) {
+    int last = queue->heap[--queue->size];
+    int parent = 0;
+
+    // Sift down
+    while (2 * parent + 1 < queue->size) {
+        int child = 2 * parent + 1;
+        if (child + 1 < queue->size && runs_before(processes, queue->heap[child + 1], queue->heap[child])) {
+            child++;
+        }
+        if (!runs_before(processes, queue->heap[child], last)) break;
+        queue->heap[parent] = queue->heap[child];
+        parent = child;
+    }
+    queue->heap[parent] = last;
+}
+
+/**
+ * Policy: a newly arrived process joins the ready heap
+ */
+static void srtf_admit(Simulation *sim, int p) {
+    srtf_queue_push((SrtfQueue *)sim->state, sim->processes, p);
+}
+
+/**
+ * Policy: run the process with the least remaining time
+ * It stays at the top of the heap while it runs, since its key only shrinks.
+ */
+static int srtf_select(Simulation *sim) {
+    SrtfQueue *ready = (SrtfQueue *)sim->state;
+    return (ready->size > 0) ? ready->heap[0] : -1;
+}
+
+/**
+ * Policy: run until completion or the next arrival, which might preempt it
+ */
+static int srtf_slice(Simulation *sim, int p) {
+    int run_until = sim->current_time + sim->processes->remaining_time[p];
+    int next_arrival = sim_next_arrival_time(sim);
+    if (next_arrival < run_until) run_until = next_arrival;
+    return run_until - sim->current_time;
+}
+
+/**
+ * Policy: a finished process leaves the heap (arrivals with a zero burst never outrank it)
+ */
+static void srtf_slice_end(Simulation *sim, int p, bool completed) {
+    (void)p;
+    if (completed) {
+        srtf_queue_pop((SrtfQueue *)sim->state, sim->processes);
+    }
+}
+
+static const SimPolicy srtf_policy = { srtf_admit, srtf_select, srtf_slice, srtf_slice_end };
+
+/**
+ * SRTF scheduling algorithm (preemptive)
+ * Runs the ready process with the least remaining time until it completes or a new
+ * arrival might preempt it
+ */
+void srtf_schedule(ProcessTable *processes, GanttSink *gantt) {
+    int n = processes->count;
+    if (n <= 0) return;
+
+    // The sink merges consecutive slices of the same process into one entry
+    SrtfQueue ready = { (int *)malloc(n * sizeof(int)), 0 };
+    Simulation sim;
+    sim_init(&sim, processes, gantt, &srtf_policy, &ready);
+    sim_run(&sim);
+
+    sim_free(&sim);
+    free(ready.heap);
+}
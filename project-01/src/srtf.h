@@ -0,0 +1,22 @@
+#ifndef SRTF_H
+#define SRTF_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+#include "simulation.h"
+
+// Ready queue: binary min-heap of process indices keyed on (remaining_time, arrival_time, index)
+typedef struct {
+    int *heap;
+    int size;
+} SrtfQueue;
+
+// Function declarations
+void srtf_schedule(ProcessTable *processes, GanttSink *gantt);
+
+#endif // SRTF_H
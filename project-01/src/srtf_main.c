@@ -0,0 +1,39 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Shortest Remaining Time First (SRTF) driver program
+
+ * Usage: ./srtf [trace]
+ */
+
+#include "srtf.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    const char *filename = (argc > 1) ? argv[1] : "processes.txt";
+    Arena arena;
+    ProcessTable processes;
+    GanttTextSink gantt;
+
+    // All process storage comes from one arena; the chart is printed as it is produced
+    arena_init(&arena);
+    gantt_text_sink_init(&gantt, stdout);
+
+    // Read process data
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        arena_free(&arena);
+        return 1;
+    }
+
+    printf("---Shortest Remaining Time First (SRTF) Scheduling---\n");
+    srtf_schedule(&processes, &gantt.sink);
+    gantt_close(&gantt.sink);
+    print_scheduling_results(&processes);
+
+    arena_free(&arena);
+    return 0;
+}
@@ -0,0 +1,395 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Parameter sweep over scheduler, time quantum, memory size, page size,
+ * allocation algorithm and page replacement algorithm
+
+ * The trace is read once and shared read-only. Every combination of the swept values
+ * becomes one point; a pool of host threads claims points one at a time and runs each
+ * on the thread's private copy of the process table. All results are printed together
+ * as one table, in the order the points were generated.
+
+ * Usage: ./sweep [-s sjf,rr] [-q 2,3,4] [-m 512,1024] [-p 32,64] [-a first,best,worst,buddy,tlsf]
+ *                [-r fifo,lru] [-j threads] [-o results.csv] [trace]
+ * Numeric lists also accept ranges such as 1-10, and sizes a K, M, G or T suffix (256G, 2M).
+ */
+
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "sweep.h"
+#include "sjf.h"
+#include "round_robin.h"
+
+static const char *const scheduler_names[] = { "sjf", "rr" };
+static const char *const alloc_names[] = { "first", "best", "worst", "buddy", "tlsf" };
+static const char *const page_names[] = { "fifo", "lru" };
+
+// State shared by the sweep threads
+typedef struct {
+    const ProcessTable *processes;
+    const SweepPoint *points;
+    SweepResult *results;
+    int num_points;
+    int next_point; // Claimed with an atomic add
+} SweepShared;
+
+/**
+ * Default sweep: both schedulers and every list algorithm at the default sizes and quantum
+ * (BUDDY and TLSF are only swept when asked for with -a)
+ */
+void sweep_default_spec(SweepSpec *spec) {
+    spec->schedulers[0] = SWEEP_SJF;
+    spec->schedulers[1] = SWEEP_ROUND_ROBIN;
+    spec->num_schedulers = 2;
+    spec->quanta[0] = TIME_QUANTUM;
+    spec->num_quanta = 1;
+    spec->memory_sizes[0] = MEMORY_SIZE;
+    spec->num_memory_sizes = 1;
+    spec->page_sizes[0] = PAGE_SIZE;
+    spec->num_page_sizes = 1;
+    spec->alloc_algs[0] = FIRST_FIT;
+    spec->alloc_algs[1] = BEST_FIT;
+    spec->alloc_algs[2] = WORST_FIT;
+    spec->num_alloc_algs = 3;
+    spec->page_algs[0] = FIFO;
+    spec->page_algs[1] = LRU;
+    spec->num_page_algs = 2;
+}
+
+/**
+ * Build the cross-product of a spec (SJF ignores the quantum list)
+ * Returns the number of points, or -1 if a memory/page size pair is invalid.
+ */
+int sweep_expand(const SweepSpec *spec, SweepPoint **points) {
+    for (int m = 0; m < spec->num_memory_sizes; m++) {
+        for (int p = 0; p < spec->num_page_sizes; p++) {
+            if (!check_memory_config(spec->memory_sizes[m], spec->page_sizes[p])) return -1;
+        }
+    }
+
+    int per_quantum = spec->num_memory_sizes * spec->num_page_sizes * spec->num_alloc_algs * spec->num_page_algs;
+    int capacity = per_quantum * spec->num_schedulers * spec->num_quanta;
+    int count = 0;
+    *points = (SweepPoint *)malloc((capacity > 0 ? capacity : 1) * sizeof(SweepPoint));
+
+    for (int s = 0; s < spec->num_schedulers; s++) {
+        int num_quanta = (spec->schedulers[s] == SWEEP_ROUND_ROBIN) ? spec->num_quanta : 1;
+        for (int q = 0; q < num_quanta; q++) {
+            for (int m = 0; m < spec->num_memory_sizes; m++) {
+                for (int p = 0; p < spec->num_page_sizes; p++) {
+                    for (int a = 0; a < spec->num_alloc_algs; a++) {
+                        for (int r = 0; r < spec->num_page_algs; r++) {
+                            SweepPoint *point = &(*points)[count++];
+                            point->scheduler = spec->schedulers[s];
+                            point->time_quantum = (spec->schedulers[s] == SWEEP_ROUND_ROBIN) ? spec->quanta[q] : 0;
+                            point->memory_size = spec->memory_sizes[m];
+                            point->page_size = spec->page_sizes[p];
+                            point->alloc_alg = spec->alloc_algs[a];
+                            point->page_alg = spec->page_algs[r];
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * Sweep thread: claim points until none are left
+ */
+static void *sweep_worker(void *arg) {
+    SweepShared *shared = (SweepShared *)arg;
+    Arena arena;
+    ProcessTable processes;
+    GanttCounter gantt;
+    MemoryManager mm;
+    bool have_memory_manager = false;
+
+    // Private copy of the table, reused for every point this thread runs
+    arena_init(&arena);
+    process_table_clone(&processes, shared->processes, &arena);
+
+    while (true) {
+        int i = __atomic_fetch_add(&shared->next_point, 1, __ATOMIC_RELAXED);
+        if (i >= shared->num_points) break;
+        const SweepPoint *point = &shared->points[i];
+        SweepResult *result = &shared->results[i];
+
+        process_table_reset(&processes);
+        process_table_set_page_size(&processes, point->page_size);
+
+        // Points with the same memory configuration reuse the manager and its block pool
+        if (have_memory_manager && mm.memory_size == point->memory_size && mm.page_size == point->page_size) {
+            reset_memory_manager(&mm);
+        } else {
+            if (have_memory_manager) {
+                cleanup_memory_manager(&mm);
+            }
+            init_memory_manager(&mm, point->memory_size, point->page_size);
+            have_memory_manager = true;
+        }
+        mm.print_warnings = false;
+
+        // Only the end of the timeline is needed
+        gantt_counter_init(&gantt);
+        if (point->scheduler == SWEEP_SJF) {
+            sjf_with_memory(&processes, &gantt.sink, &mm, point->alloc_alg, point->page_alg);
+        } else {
+            round_robin_with_memory(&processes, &gantt.sink, &mm, point->alloc_alg, point->page_alg, point->time_quantum);
+        }
+
+        compute_average_times(&processes, &result->average_waiting, &result->average_turnaround);
+        result->p99_waiting = histogram_percentile(&processes.metrics->waiting_time, 99.0);
+        result->makespan = gantt.last.end_time;
+        result->failed_allocations = mm.failed_allocations;
+        result->page_replacements = mm.page_replacements;
+    }
+
+    if (have_memory_manager) {
+        cleanup_memory_manager(&mm);
+    }
+    arena_free(&arena);
+    return NULL;
+}
+
+/**
+ * Run every point on a pool of host threads (0 or less means one per online CPU)
+ * Returns the number of threads used.
+ */
+int sweep_run(const ProcessTable *processes, const SweepPoint points[], SweepResult results[],
+              int num_points, int num_threads) {
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (cpus < 1) ? 1 : (int)cpus;
+    }
+    if (num_threads > num_points) num_threads = num_points;
+    if (num_threads < 1) num_threads = 1;
+
+    SweepShared shared = { processes, points, results, num_points, 0 };
+
+    // The calling thread takes part in the sweep
+    pthread_t *threads = (pthread_t *)malloc(num_threads * sizeof(pthread_t));
+    for (int t = 1; t < num_threads; t++) {
+        pthread_create(&threads[t], NULL, sweep_worker, &shared);
+    }
+    sweep_worker(&shared);
+    for (int t = 1; t < num_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    return num_threads;
+}
+
+/**
+ * Print the consolidated results table (tab separated, or CSV)
+ */
+void print_sweep_results(FILE *out, const SweepPoint points[], const SweepResult results[],
+                         int num_points, bool csv) {
+    const char *sep = csv ? "," : "\t";
+
+    fprintf(out, "Scheduler%sQuantum%sMemory%sPage%sAlloc%sPaging%sAvgWait%sP99Wait%sAvgTurnaround%sMakespan%sAllocFail%sPageRepl\n",
+            sep, sep, sep, sep, sep, sep, sep, sep, sep, sep, sep);
+    if (!csv) {
+        fprintf(out, "---------\t-------\t------\t----\t-----\t------\t-------\t-------\t-------------\t--------\t---------\t--------\n");
+    }
+
+    for (int i = 0; i < num_points; i++) {
+        const SweepPoint *point = &points[i];
+        const SweepResult *result = &results[i];
+        fprintf(out, "%s%s%d%s%lld%s%d%s%s%s%s%s%.2f%s%lld%s%.2f%s%d%s%d%s%d\n",
+                scheduler_names[point->scheduler], sep, point->time_quantum, sep,
+                point->memory_size, sep, point->page_size, sep,
+                alloc_names[point->alloc_alg], sep, page_names[point->page_alg], sep,
+                result->average_waiting, sep, result->p99_waiting, sep, result->average_turnaround, sep,
+                result->makespan, sep, result->failed_allocations, sep, result->page_replacements);
+    }
+}
+
+/**
+ * Parse a comma separated list of positive sizes and ranges (lo-hi)
+ * Returns the number of values, or -1 on error.
+ */
+static int parse_size_list(const char *text, long long values[], const char *option) {
+    int count = 0;
+    const char *cursor = text;
+
+    while (*cursor != '\0') {
+        char *end = (char *)cursor;
+        long long low = parse_memory_size(cursor, &end);
+        long long high = low;
+        if (low < 0) break;
+        if (*end == '-') {
+            high = parse_memory_size(end + 1, &end);
+            if (high < 0) break;
+        }
+        if (low <= 0 || high < low) break;
+
+        for (long long value = low; value <= high; value++) {
+            if (count == SWEEP_MAX_VALUES) {
+                printf("Error: At most %d values for -%s\n", SWEEP_MAX_VALUES, option);
+                return -1;
+            }
+            values[count++] = value;
+        }
+
+        if (*end == '\0') return count;
+        if (*end != ',') break;
+        cursor = end + 1;
+    }
+
+    printf("Error: Invalid list for -%s: '%s'\n", option, text);
+    return -1;
+}
+
+/**
+ * Parse a comma separated list of positive integers and ranges (lo-hi) that fit an int
+ * Returns the number of values, or -1 on error.
+ */
+static int parse_int_list(const char *text, int values[], const char *option) {
+    long long sizes[SWEEP_MAX_VALUES];
+    int count = parse_size_list(text, sizes, option);
+
+    for (int i = 0; i < count; i++) {
+        if (sizes[i] > INT_MAX) {
+            printf("Error: Invalid list for -%s: '%s'\n", option, text);
+            return -1;
+        }
+        values[i] = (int)sizes[i];
+    }
+    return count;
+}
+
+/**
+ * Parse a comma separated list of names into their positions in names[]
+ * Returns the number of values, or -1 on error.
+ */
+static int parse_name_list(const char *text, const char *const names[], int num_names,
+                           int values[], const char *option) {
+    int count = 0;
+    const char *cursor = text;
+
+    while (true) {
+        size_t length = strcspn(cursor, ",");
+        int match = -1;
+        for (int i = 0; i < num_names; i++) {
+            if (strlen(names[i]) == length && strncmp(cursor, names[i], length) == 0) {
+                match = i;
+            }
+        }
+        if (match == -1 || count == num_names) {
+            printf("Error: Invalid list for -%s: '%s'\n", option, text);
+            return -1;
+        }
+        values[count++] = match;
+
+        if (cursor[length] == '\0') return count;
+        cursor += length + 1;
+    }
+}
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    SweepSpec spec;
+    int names[5];
+    int num_threads = 0;
+    const char *csv_filename = NULL;
+    int option;
+
+    sweep_default_spec(&spec);
+
+    while ((option = getopt(argc, argv, "s:q:m:p:a:r:j:o:")) != -1) {
+        int count = 0;
+        switch (option) {
+            case 's':
+                count = parse_name_list(optarg, scheduler_names, 2, names, "s");
+                for (int i = 0; i < count; i++) spec.schedulers[i] = (SweepScheduler)names[i];
+                spec.num_schedulers = count;
+                break;
+            case 'q':
+                count = spec.num_quanta = parse_int_list(optarg, spec.quanta, "q");
+                break;
+            case 'm':
+                count = spec.num_memory_sizes = parse_size_list(optarg, spec.memory_sizes, "m");
+                break;
+            case 'p':
+                count = spec.num_page_sizes = parse_int_list(optarg, spec.page_sizes, "p");
+                break;
+            case 'a':
+                count = parse_name_list(optarg, alloc_names, 5, names, "a");
+                for (int i = 0; i < count; i++) spec.alloc_algs[i] = (AllocationAlgorithm)names[i];
+                spec.num_alloc_algs = count;
+                break;
+            case 'r':
+                count = parse_name_list(optarg, page_names, 2, names, "r");
+                for (int i = 0; i < count; i++) spec.page_algs[i] = (PageReplacementAlgorithm)names[i];
+                spec.num_page_algs = count;
+                break;
+            case 'j':
+                num_threads = atoi(optarg);
+                break;
+            case 'o':
+                csv_filename = optarg;
+                break;
+            default:
+                count = -1;
+                break;
+        }
+        if (count < 0) {
+            printf("Usage: %s [-s sjf,rr] [-q 2,3,4] [-m 512,1024] [-p 32,64] [-a first,best,worst,buddy,tlsf] "
+                   "[-r fifo,lru] [-j threads] [-o results.csv] [trace]\n", argv[0]);
+            return 1;
+        }
+    }
+    const char *filename = (optind < argc) ? argv[optind] : "processes.txt";
+
+    SweepPoint *points;
+    int num_points = sweep_expand(&spec, &points);
+    if (num_points < 0) return 1;
+
+    // The trace is read once; every thread shares its columns read-only
+    Arena arena;
+    ProcessTable processes;
+    arena_init(&arena);
+    if (read_processes_from_file(filename, &arena, &processes) == 0) {
+        free(points);
+        arena_free(&arena);
+        return 1;
+    }
+
+    SweepResult *results = (SweepResult *)malloc((num_points > 0 ? num_points : 1) * sizeof(SweepResult));
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int threads_used = sweep_run(&processes, points, results, num_points, num_threads);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    printf("---Parameter Sweep---\n");
+    printf("Trace: %s (%d processes), Points: %d, Threads: %d\n\n", filename, processes.count, num_points, threads_used);
+    print_sweep_results(stdout, points, results, num_points, false);
+    printf("\nSweep completed in %.2f seconds\n", seconds);
+
+    if (csv_filename != NULL) {
+        FILE *csv = fopen(csv_filename, "w");
+        if (csv == NULL) {
+            printf("Error: Could not open file '%s'\n", csv_filename);
+        } else {
+            print_sweep_results(csv, points, results, num_points, true);
+            fclose(csv);
+            printf("Results written to %s\n", csv_filename);
+        }
+    }
+
+    free(results);
+    free(points);
+    arena_free(&arena);
+    return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "gantt.h"
+#include "process.h"
+#include "memory_manager.h"
+
+// Most values accepted for one swept parameter
+#define SWEEP_MAX_VALUES 64
+
+// Schedulers that take part in a sweep
+typedef enum {
+    SWEEP_SJF,
+    SWEEP_ROUND_ROBIN
+} SweepScheduler;
+
+// Lists of values to sweep over; every combination is run
+typedef struct {
+    SweepScheduler schedulers[2];
+    int num_schedulers;
+    int quanta[SWEEP_MAX_VALUES]; // Round Robin only
+    int num_quanta;
+    long long memory_sizes[SWEEP_MAX_VALUES];
+    int num_memory_sizes;
+    int page_sizes[SWEEP_MAX_VALUES];
+    int num_page_sizes;
+    AllocationAlgorithm alloc_algs[5];
+    int num_alloc_algs;
+    PageReplacementAlgorithm page_algs[2];
+    int num_page_algs;
+} SweepSpec;
+
+// One configuration of the sweep
+typedef struct {
+    SweepScheduler scheduler;
+    int time_quantum; // 0 for SJF
+    long long memory_size;
+    int page_size;
+    AllocationAlgorithm alloc_alg;
+    PageReplacementAlgorithm page_alg;
+} SweepPoint;
+
+// Results of one configuration
+typedef struct {
+    double average_waiting;
+    double average_turnaround;
+    long long p99_waiting;
+    int makespan;
+    int failed_allocations;
+    int page_replacements;
+} SweepResult;
+
+// Function declarations
+void sweep_default_spec(SweepSpec *spec);
+int sweep_expand(const SweepSpec *spec, SweepPoint **points);
+int sweep_run(const ProcessTable *processes, const SweepPoint points[], SweepResult results[],
+              int num_points, int num_threads);
+void print_sweep_results(FILE *out, const SweepPoint points[], const SweepResult results[],
+                         int num_points, bool csv);
+
+#endif // SWEEP_H
@@ -0,0 +1,397 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Interval index over a completed single-CPU Gantt timeline
+
+ * The entries are stored column by column. On one CPU they are in time order and do
+ * not overlap, so "what ran at t" and "what ran between t1 and t2" are binary searches
+ * over the start and end columns. A per-process slice list (grouped by PID, each group
+ * in time order) answers "when did PID x run" with one more binary search over the
+ * sorted PIDs. The index is written with the same aligned column layout as binary
+ * traces and queried straight from a read-only mapping, so nothing is parsed at load.
+
+ * Input: GanttEntry sequence (in memory or a binary Gantt file from a GanttFileSink)
+ * Output: TimelineIndex built in an arena or mapped from an index file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "timeline.h"
+
+/**
+ * Map a whole file read-only
+ * Returns the mapping, or NULL on error
+ */
+static void *map_file(const char *filename, size_t *size) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: Could not open file '%s'\n", filename);
+        return NULL;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        printf("Error: File '%s' is empty\n", filename);
+        close(fd);
+        return NULL;
+    }
+
+    *size = (size_t)info.st_size;
+    void *data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        printf("Error: Could not map file '%s'\n", filename);
+        return NULL;
+    }
+    return data;
+}
+
+/**
+ * Map a binary Gantt file and check its header
+ */
+bool gantt_file_map(const char *filename, GanttFileView *view) {
+    memset(view, 0, sizeof(*view));
+
+    size_t size;
+    void *data = map_file(filename, &size);
+    if (data == NULL) return false;
+
+    GanttFileHeader header;
+    if (size >= sizeof(header)) {
+        memcpy(&header, data, sizeof(header));
+    }
+    if (size < sizeof(header) || memcmp(header.magic, GANTT_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != GANTT_FILE_VERSION || header.entry_size != sizeof(GanttEntry) ||
+        header.count > (size - sizeof(header)) / sizeof(GanttEntry)) {
+        printf("Error: '%s' is not a valid Gantt file\n", filename);
+        munmap(data, size);
+        return false;
+    }
+
+    view->entries = (const GanttEntry *)((const char *)data + sizeof(header));
+    view->count = header.count;
+    view->mapping = data;
+    view->mapping_size = size;
+    return true;
+}
+
+/**
+ * Release a mapped Gantt file
+ */
+void gantt_file_unmap(GanttFileView *view) {
+    if (view->mapping != NULL) {
+        munmap(view->mapping, view->mapping_size);
+    }
+    memset(view, 0, sizeof(*view));
+}
+
+/**
+ * Compare (pid, entry) keys for the sparse PID grouping
+ */
+static int compare_keys(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Group entry numbers by PID
+ * Dense PID ranges use a counting pass; sparse ones sort (pid, entry) keys.
+ */
+static bool build_pid_index(TimelineIndex *index, const int32_t process_id[], Arena *arena) {
+    uint64_t count = index->count;
+    uint32_t *slices = arena_alloc(arena, count * sizeof(uint32_t));
+    int32_t min_pid = 0, max_pid = 0;
+
+    for (uint64_t i = 0; i < count; i++) {
+        if (i == 0 || process_id[i] < min_pid) min_pid = process_id[i];
+        if (i == 0 || process_id[i] > max_pid) max_pid = process_id[i];
+    }
+    uint64_t range = (count == 0) ? 0 : (uint64_t)((int64_t)max_pid - min_pid) + 1;
+
+    if (range <= 2 * count + 1024) {
+        uint64_t *offsets = calloc(range + 1, sizeof(uint64_t));
+        if (offsets == NULL) return false;
+
+        uint64_t num_pids = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            if (offsets[(int64_t)process_id[i] - min_pid + 1]++ == 0) num_pids++;
+        }
+
+        int32_t *keys = arena_alloc(arena, num_pids * sizeof(int32_t));
+        uint64_t *first = arena_alloc(arena, (num_pids + 1) * sizeof(uint64_t));
+        uint64_t k = 0;
+        for (uint64_t p = 0; p < range; p++) {
+            if (offsets[p + 1] > 0) {
+                keys[k] = (int32_t)((int64_t)min_pid + (int64_t)p);
+                first[k] = offsets[p];
+                k++;
+            }
+            offsets[p + 1] += offsets[p];
+        }
+        first[num_pids] = count;
+
+        // Entries are visited in time order, so each group stays in time order
+        for (uint64_t i = 0; i < count; i++) {
+            slices[offsets[(int64_t)process_id[i] - min_pid]++] = (uint32_t)i;
+        }
+        free(offsets);
+
+        index->pid_keys = keys;
+        index->pid_first = first;
+        index->num_pids = num_pids;
+    } else {
+        // Bias the PID so the unsigned key order is the signed PID order
+        uint64_t *sorted = malloc(count * sizeof(uint64_t));
+        if (sorted == NULL) return false;
+        for (uint64_t i = 0; i < count; i++) {
+            sorted[i] = ((uint64_t)((uint32_t)process_id[i] ^ 0x80000000u) << 32) | i;
+        }
+        qsort(sorted, count, sizeof(uint64_t), compare_keys);
+
+        uint64_t num_pids = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            if (i == 0 || (sorted[i] >> 32) != (sorted[i - 1] >> 32)) num_pids++;
+        }
+
+        int32_t *keys = arena_alloc(arena, num_pids * sizeof(int32_t));
+        uint64_t *first = arena_alloc(arena, (num_pids + 1) * sizeof(uint64_t));
+        uint64_t k = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            if (i == 0 || (sorted[i] >> 32) != (sorted[i - 1] >> 32)) {
+                keys[k] = (int32_t)((uint32_t)(sorted[i] >> 32) ^ 0x80000000u);
+                first[k] = i;
+                k++;
+            }
+            slices[i] = (uint32_t)sorted[i];
+        }
+        first[num_pids] = count;
+        free(sorted);
+
+        index->pid_keys = keys;
+        index->pid_first = first;
+        index->num_pids = num_pids;
+    }
+
+    index->pid_slices = slices;
+    return true;
+}
+
+/**
+ * Build an index from a timeline, with all columns allocated from the arena
+ * The entries must be in time order and must not overlap (one CPU).
+ */
+bool timeline_build(TimelineIndex *index, const GanttEntry entries[], uint64_t count, Arena *arena) {
+    memset(index, 0, sizeof(*index));
+
+    if (count > UINT32_MAX) {
+        printf("Error: Timeline has too many entries (%llu)\n", (unsigned long long)count);
+        return false;
+    }
+
+    int32_t *start_time = arena_alloc(arena, count * sizeof(int32_t));
+    int32_t *end_time = arena_alloc(arena, count * sizeof(int32_t));
+    int32_t *process_id = arena_alloc(arena, count * sizeof(int32_t));
+
+    for (uint64_t i = 0; i < count; i++) {
+        if (entries[i].end_time < entries[i].start_time ||
+            (i > 0 && entries[i].start_time < entries[i - 1].end_time)) {
+            printf("Error: Gantt entry %llu is out of time order\n", (unsigned long long)i);
+            return false;
+        }
+        start_time[i] = entries[i].start_time;
+        end_time[i] = entries[i].end_time;
+        process_id[i] = entries[i].process_id;
+    }
+
+    index->start_time = start_time;
+    index->end_time = end_time;
+    index->process_id = process_id;
+    index->count = count;
+
+    if (!build_pid_index(index, process_id, arena)) {
+        printf("Error: Not enough memory to index the timeline\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Column pointers and sizes in file order
+ */
+static void timeline_columns(const TimelineIndex *index, const void *columns[], uint64_t sizes[]) {
+    columns[0] = index->start_time;
+    columns[1] = index->end_time;
+    columns[2] = index->process_id;
+    columns[3] = index->pid_keys;
+    columns[4] = index->pid_first;
+    columns[5] = index->pid_slices;
+    sizes[0] = index->count * sizeof(int32_t);
+    sizes[1] = index->count * sizeof(int32_t);
+    sizes[2] = index->count * sizeof(int32_t);
+    sizes[3] = index->num_pids * sizeof(int32_t);
+    sizes[4] = (index->num_pids + 1) * sizeof(uint64_t);
+    sizes[5] = index->count * sizeof(uint32_t);
+}
+
+/**
+ * Write an index file
+ */
+bool timeline_write(const char *filename, const TimelineIndex *index) {
+    const void *columns[TIMELINE_NUM_COLUMNS];
+    uint64_t sizes[TIMELINE_NUM_COLUMNS];
+    TimelineFileHeader header;
+
+    timeline_columns(index, columns, sizes);
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TIMELINE_MAGIC, sizeof(header.magic));
+    header.version = TIMELINE_VERSION;
+    header.header_size = sizeof(header);
+    header.count = index->count;
+    header.num_pids = index->num_pids;
+
+    uint64_t offset = sizeof(header);
+    for (int c = 0; c < TIMELINE_NUM_COLUMNS; c++) {
+        offset = (offset + TIMELINE_COLUMN_ALIGNMENT - 1) / TIMELINE_COLUMN_ALIGNMENT * TIMELINE_COLUMN_ALIGNMENT;
+        header.column_offset[c] = offset;
+        offset += sizes[c];
+    }
+
+    FILE *file = fopen(filename, "wb");
+    if (file == NULL) {
+        printf("Error: Could not create file '%s'\n", filename);
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    uint64_t written = sizeof(header);
+    static const char padding[TIMELINE_COLUMN_ALIGNMENT] = {0};
+    for (int c = 0; c < TIMELINE_NUM_COLUMNS && ok; c++) {
+        ok = fwrite(padding, 1, header.column_offset[c] - written, file) == header.column_offset[c] - written;
+        ok = ok && fwrite(columns[c], 1, sizes[c], file) == sizes[c];
+        written = header.column_offset[c] + sizes[c];
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) {
+        printf("Error: Could not write file '%s'\n", filename);
+    }
+    return ok;
+}
+
+/**
+ * Map an index file; the columns point straight into the mapping
+ */
+bool timeline_open(const char *filename, TimelineIndex *index) {
+    memset(index, 0, sizeof(*index));
+
+    size_t size;
+    void *data = map_file(filename, &size);
+    if (data == NULL) return false;
+
+    TimelineFileHeader header;
+    bool ok = size >= sizeof(header);
+    if (ok) {
+        memcpy(&header, data, sizeof(header));
+        ok = memcmp(header.magic, TIMELINE_MAGIC, sizeof(header.magic)) == 0 &&
+             header.version == TIMELINE_VERSION && header.header_size == sizeof(header) &&
+             header.count <= UINT32_MAX && header.num_pids <= header.count;
+    }
+
+    const void *columns[TIMELINE_NUM_COLUMNS];
+    uint64_t sizes[TIMELINE_NUM_COLUMNS];
+    if (ok) {
+        index->count = header.count;
+        index->num_pids = header.num_pids;
+        timeline_columns(index, columns, sizes);
+        for (int c = 0; c < TIMELINE_NUM_COLUMNS && ok; c++) {
+            ok = header.column_offset[c] % TIMELINE_COLUMN_ALIGNMENT == 0 &&
+                 header.column_offset[c] <= size && sizes[c] <= size - header.column_offset[c];
+        }
+    }
+    if (!ok) {
+        printf("Error: '%s' is not a valid timeline index\n", filename);
+        munmap(data, size);
+        memset(index, 0, sizeof(*index));
+        return false;
+    }
+
+    const char *base = (const char *)data;
+    index->start_time = (const int32_t *)(base + header.column_offset[0]);
+    index->end_time = (const int32_t *)(base + header.column_offset[1]);
+    index->process_id = (const int32_t *)(base + header.column_offset[2]);
+    index->pid_keys = (const int32_t *)(base + header.column_offset[3]);
+    index->pid_first = (const uint64_t *)(base + header.column_offset[4]);
+    index->pid_slices = (const uint32_t *)(base + header.column_offset[5]);
+    index->mapping = data;
+    index->mapping_size = size;
+    return true;
+}
+
+/**
+ * Release the mapping behind an index (arena-built indexes are freed with the arena)
+ */
+void timeline_close(TimelineIndex *index) {
+    if (index->mapping != NULL) {
+        munmap(index->mapping, index->mapping_size);
+    }
+    memset(index, 0, sizeof(*index));
+}
+
+/**
+ * Number of leading values in a sorted column that are <= value
+ */
+static uint64_t count_at_most(const int32_t column[], uint64_t count, int value) {
+    uint64_t low = 0, high = count;
+    while (low < high) {
+        uint64_t mid = low + (high - low) / 2;
+        if (column[mid] <= value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/**
+ * Entry running at a time, or -1 if the CPU was idle
+ */
+int64_t timeline_at(const TimelineIndex *index, int time) {
+    uint64_t started = count_at_most(index->start_time, index->count, time);
+    if (started == 0 || time >= index->end_time[started - 1]) return -1;
+    return (int64_t)(started - 1);
+}
+
+/**
+ * Entries overlapping [from, to): *first is set to the first of them
+ * Returns the number of entries
+ */
+uint64_t timeline_range(const TimelineIndex *index, int from, int to, uint64_t *first) {
+    // Entries ending at or before `from` come first, entries starting at or after `to` last
+    *first = count_at_most(index->end_time, index->count, from);
+    if (to <= from) return 0;
+    uint64_t last = count_at_most(index->start_time, index->count, to - 1);
+    return (last > *first) ? last - *first : 0;
+}
+
+/**
+ * Entries a process ran, in time order
+ * Returns the number of entries (0 if the process never ran)
+ */
+uint64_t timeline_pid_slices(const TimelineIndex *index, int process_id, const uint32_t **slices) {
+    uint64_t k = count_at_most(index->pid_keys, index->num_pids, process_id);
+    if (k == 0 || index->pid_keys[k - 1] != process_id) {
+        *slices = NULL;
+        return 0;
+    }
+    *slices = index->pid_slices + index->pid_first[k - 1];
+    return index->pid_first[k] - index->pid_first[k - 1];
+}
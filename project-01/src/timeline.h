@@ -0,0 +1,66 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "arena.h"
+#include "gantt.h"
+
+// Index file: header followed by one column per array below, each 64-byte aligned
+#define TIMELINE_MAGIC "GANTTIDX"
+#define TIMELINE_VERSION 1
+#define TIMELINE_NUM_COLUMNS 6
+#define TIMELINE_COLUMN_ALIGNMENT 64
+
+// Index file header (native byte order, like the Gantt file it is built from)
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t count;
+    uint64_t num_pids;
+    uint64_t column_offset[TIMELINE_NUM_COLUMNS];
+} TimelineFileHeader;
+
+// Queryable single-CPU timeline. Entries are in time order and do not overlap, so
+// both start_time and end_time are sorted and can be binary searched.
+typedef struct {
+    const int32_t *start_time;
+    const int32_t *end_time;
+    const int32_t *process_id;
+    uint64_t count;
+
+    // Per-process slices: process pid_keys[k] ran entries
+    // pid_slices[pid_first[k]] .. pid_slices[pid_first[k + 1] - 1], in time order
+    const int32_t *pid_keys;
+    const uint64_t *pid_first;
+    const uint32_t *pid_slices;
+    uint64_t num_pids;
+
+    // Set when the columns point into a mapped index file
+    void *mapping;
+    size_t mapping_size;
+} TimelineIndex;
+
+// Read-only view of a binary Gantt file written by a GanttFileSink
+typedef struct {
+    const GanttEntry *entries;
+    uint64_t count;
+    void *mapping;
+    size_t mapping_size;
+} GanttFileView;
+
+// Timeline functions
+bool gantt_file_map(const char *filename, GanttFileView *view);
+void gantt_file_unmap(GanttFileView *view);
+bool timeline_build(TimelineIndex *index, const GanttEntry entries[], uint64_t count, Arena *arena);
+bool timeline_write(const char *filename, const TimelineIndex *index);
+bool timeline_open(const char *filename, TimelineIndex *index);
+void timeline_close(TimelineIndex *index);
+int64_t timeline_at(const TimelineIndex *index, int time);
+uint64_t timeline_range(const TimelineIndex *index, int from, int to, uint64_t *first);
+uint64_t timeline_pid_slices(const TimelineIndex *index, int process_id, const uint32_t **slices);
+
+#endif // TIMELINE_H
@@ -0,0 +1,432 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Trace loader shared by the schedulers
+
+ * The trace file is mapped into memory and parsed in place with a small hand-written
+ * integer parser instead of fscanf. Large files are split at line boundaries and the
+ * pieces are parsed on separate threads straight into the final column arrays.
+
+ * Binary traces (see TraceFileHeader) are detected by their magic number and mapped
+ * with no parsing at all: the columns point straight into the file mapping.
+
+ * Input: text trace with a header line followed by PID Arrival_Time Burst_Time Priority,
+ *        or a binary trace written by trace_write_binary
+ * Output: Trace columns allocated from the caller's arena or mapped from the file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "trace.h"
+
+// One piece of the file handled by one thread
+typedef struct {
+    const char *start;
+    const char *end;
+    int newlines;
+    int first_line;
+    int first_row;
+    int rows;
+    int error_line;
+    Trace *trace;
+} TraceChunk;
+
+/**
+ * Skip spaces, tabs and carriage returns within a line
+ */
+static inline const char *skip_blanks(const char *p, const char *end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    return p;
+}
+
+/**
+ * Parse one (optionally negative) integer field, returns NULL if there is none
+ */
+static inline const char *parse_field(const char *p, const char *end, int *value) {
+    p = skip_blanks(p, end);
+    bool negative = (p < end && *p == '-');
+    p += negative;
+
+    const char *digits = p;
+    unsigned int result = 0;
+    while (p < end && (unsigned char)(*p - '0') < 10) {
+        result = result * 10 + (unsigned int)(*p - '0');
+        p++;
+    }
+    if (p == digits) return NULL;
+
+    *value = negative ? -(int)result : (int)result;
+    return p;
+}
+
+/**
+ * Count the lines in a chunk (first pass)
+ */
+static void *count_chunk_lines(void *arg) {
+    TraceChunk *chunk = (TraceChunk *)arg;
+    const char *p = chunk->start;
+
+    chunk->newlines = 0;
+    while ((p = memchr(p, '\n', chunk->end - p)) != NULL) {
+        chunk->newlines++;
+        p++;
+    }
+    return NULL;
+}
+
+/**
+ * Parse every line of a chunk into the trace columns (second pass)
+ */
+static void *parse_chunk(void *arg) {
+    TraceChunk *chunk = (TraceChunk *)arg;
+    Trace *trace = chunk->trace;
+    const char *p = chunk->start;
+    int line = chunk->first_line;
+    int row = chunk->first_row;
+
+    while (p < chunk->end) {
+        const char *line_end = memchr(p, '\n', chunk->end - p);
+        if (line_end == NULL) line_end = chunk->end;
+
+        // Blank lines are allowed, anything else must be exactly four integers
+        if (skip_blanks(p, line_end) != line_end) {
+            int fields[4];
+            const char *q = p;
+            for (int f = 0; f < 4 && q != NULL; f++) {
+                q = parse_field(q, line_end, &fields[f]);
+            }
+            if (q == NULL || skip_blanks(q, line_end) != line_end) {
+                chunk->error_line = line;
+                break;
+            }
+
+            trace->id[row] = fields[0];
+            trace->arrival_time[row] = fields[1];
+            trace->burst_time[row] = fields[2];
+            trace->priority[row] = fields[3];
+            row++;
+        }
+
+        p = line_end + 1;
+        line++;
+    }
+
+    chunk->rows = row - chunk->first_row;
+    return NULL;
+}
+
+/**
+ * Run a pass over every chunk, one thread per chunk
+ */
+static void run_chunks(TraceChunk chunks[], int num_chunks, void *(*pass)(void *)) {
+    pthread_t threads[TRACE_MAX_THREADS];
+
+    if (num_chunks == 1) {
+        pass(&chunks[0]);
+        return;
+    }
+    for (int i = 0; i < num_chunks; i++) {
+        pthread_create(&threads[i], NULL, pass, &chunks[i]);
+    }
+    for (int i = 0; i < num_chunks; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+ * Check whether this machine stores integers little-endian like the binary format
+ */
+static bool host_is_little_endian(void) {
+    const uint16_t probe = 1;
+    return *(const uint8_t *)&probe == 1;
+}
+
+/**
+ * Reverse the bytes of a 32-bit value
+ */
+static uint32_t swap32(uint32_t value) {
+    return (value >> 24) | ((value >> 8) & 0xff00) | ((value << 8) & 0xff0000) | (value << 24);
+}
+
+/**
+ * Reverse the bytes of a 64-bit value
+ */
+static uint64_t swap64(uint64_t value) {
+    return ((uint64_t)swap32((uint32_t)value) << 32) | swap32((uint32_t)(value >> 32));
+}
+
+/**
+ * Set up columns for a mapped binary trace
+ * Returns the number of processes, or 0 if the file is not a valid trace
+ */
+static int load_binary(const char *filename, Arena *arena, Trace *trace, void *data, size_t size) {
+    TraceFileHeader header;
+    bool little_endian = host_is_little_endian();
+
+    if (size < sizeof(header)) {
+        printf("Error: Binary trace '%s' is truncated\n", filename);
+        return 0;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (!little_endian) {
+        header.version = swap32(header.version);
+        header.count = swap64(header.count);
+        for (int c = 0; c < TRACE_NUM_COLUMNS; c++) {
+            header.column_offset[c] = swap64(header.column_offset[c]);
+        }
+    }
+
+    if (header.version != TRACE_VERSION) {
+        printf("Error: Binary trace '%s' has unsupported version %u\n", filename, header.version);
+        return 0;
+    }
+    if (header.count > INT32_MAX) {
+        printf("Error: Binary trace '%s' holds too many processes\n", filename);
+        return 0;
+    }
+
+    int *columns[TRACE_NUM_COLUMNS];
+    size_t column_bytes = (size_t)header.count * sizeof(int32_t);
+    for (int c = 0; c < TRACE_NUM_COLUMNS; c++) {
+        uint64_t offset = header.column_offset[c];
+        if (offset % sizeof(int32_t) != 0 || offset > size || size - offset < column_bytes) {
+            printf("Error: Binary trace '%s' is truncated\n", filename);
+            return 0;
+        }
+        columns[c] = (int *)((char *)data + offset);
+
+        // Big-endian hosts get a byte-swapped copy instead of the mapped column
+        if (!little_endian) {
+            int *copy = (int *)arena_alloc(arena, column_bytes);
+            for (uint64_t i = 0; i < header.count; i++) {
+                copy[i] = (int)swap32((uint32_t)columns[c][i]);
+            }
+            columns[c] = copy;
+        }
+    }
+
+    trace->id = columns[0];
+    trace->arrival_time = columns[1];
+    trace->burst_time = columns[2];
+    trace->priority = columns[3];
+    trace->count = (int)header.count;
+    return trace->count;
+}
+
+/**
+ * Load a text or binary trace file into columns
+ * num_threads <= 0 picks a thread count from the file size
+ * Returns the number of processes read, or 0 on error
+ */
+int trace_load(const char *filename, Arena *arena, Trace *trace, int num_threads) {
+    memset(trace, 0, sizeof(*trace));
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        printf("Error: Could not open file '%s'\n", filename);
+        return 0;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    size_t size = (size_t)info.st_size;
+    // Private writable mapping: binary columns can be used in place, copy-on-write
+    char *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        printf("Error: Could not map file '%s'\n", filename);
+        return 0;
+    }
+
+    // Binary traces need no parsing, the mapping stays alive until trace_close
+    if (size >= sizeof(TRACE_MAGIC) - 1 && memcmp(data, TRACE_MAGIC, sizeof(TRACE_MAGIC) - 1) == 0) {
+        int count = load_binary(filename, arena, trace, data, size);
+        if (count == 0 || !host_is_little_endian()) {
+            munmap(data, size);
+        } else {
+            trace->mapping = data;
+            trace->mapping_size = size;
+        }
+        return count;
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    // Skip header line
+    const char *body = memchr(data, '\n', size);
+    body = (body == NULL) ? data + size : body + 1;
+    size_t body_size = (size_t)(data + size - body);
+
+    // Choose how many pieces to split the file into
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = (body_size < TRACE_PARALLEL_MIN_BYTES || cpus < 1) ? 1 : (int)cpus;
+    }
+    if (num_threads > TRACE_MAX_THREADS) num_threads = TRACE_MAX_THREADS;
+
+    // Split at line boundaries
+    TraceChunk chunks[TRACE_MAX_THREADS];
+    int num_chunks = 0;
+    const char *chunk_start = body;
+    for (int i = 1; i <= num_threads && chunk_start < data + size; i++) {
+        const char *chunk_end = data + size;
+        if (i < num_threads) {
+            const char *split = body + body_size / num_threads * i;
+            if (split < chunk_start) split = chunk_start;
+            const char *newline = memchr(split, '\n', data + size - split);
+            if (newline != NULL) chunk_end = newline + 1;
+        }
+
+        memset(&chunks[num_chunks], 0, sizeof(TraceChunk));
+        chunks[num_chunks].start = chunk_start;
+        chunks[num_chunks].end = chunk_end;
+        chunks[num_chunks].trace = trace;
+        num_chunks++;
+        chunk_start = chunk_end;
+    }
+
+    // First pass: line counts give each chunk its line numbers and output rows
+    run_chunks(chunks, num_chunks, count_chunk_lines);
+    int max_rows = 0;
+    for (int i = 0; i < num_chunks; i++) {
+        chunks[i].first_line = max_rows + 2;
+        chunks[i].first_row = max_rows;
+        max_rows += chunks[i].newlines;
+    }
+    max_rows++; // Last line may have no trailing newline
+
+    trace->id = (int *)arena_alloc(arena, (size_t)max_rows * sizeof(int));
+    trace->arrival_time = (int *)arena_alloc(arena, (size_t)max_rows * sizeof(int));
+    trace->burst_time = (int *)arena_alloc(arena, (size_t)max_rows * sizeof(int));
+    trace->priority = (int *)arena_alloc(arena, (size_t)max_rows * sizeof(int));
+
+    // Second pass: parse every chunk into its slice of the columns
+    run_chunks(chunks, num_chunks, parse_chunk);
+    munmap(data, size);
+
+    // Report the first malformed line and close the gaps left by blank lines
+    int count = 0;
+    for (int i = 0; i < num_chunks; i++) {
+        if (chunks[i].error_line != 0) {
+            printf("Error: Malformed process data in '%s' at line %d\n", filename, chunks[i].error_line);
+            trace->count = 0;
+            return 0;
+        }
+        if (chunks[i].first_row != count) {
+            size_t bytes = (size_t)chunks[i].rows * sizeof(int);
+            memmove(trace->id + count, trace->id + chunks[i].first_row, bytes);
+            memmove(trace->arrival_time + count, trace->arrival_time + chunks[i].first_row, bytes);
+            memmove(trace->burst_time + count, trace->burst_time + chunks[i].first_row, bytes);
+            memmove(trace->priority + count, trace->priority + chunks[i].first_row, bytes);
+        }
+        count += chunks[i].rows;
+    }
+
+    trace->count = count;
+    return count;
+}
+
+/**
+ * Write one column as little-endian int32 values
+ */
+static bool write_column(FILE *file, const int *column, int count) {
+    if (host_is_little_endian()) {
+        return fwrite(column, sizeof(int32_t), (size_t)count, file) == (size_t)count;
+    }
+
+    for (int i = 0; i < count; i++) {
+        uint32_t value = swap32((uint32_t)column[i]);
+        if (fwrite(&value, sizeof(value), 1, file) != 1) return false;
+    }
+    return true;
+}
+
+/**
+ * Save a trace in the binary columnar format, with min/max stats for each column
+ * The header that was written is copied to header_out when it is not NULL
+ */
+bool trace_write_binary(const char *filename, const Trace *trace, TraceFileHeader *header_out) {
+    const int *columns[TRACE_NUM_COLUMNS] = { trace->id, trace->arrival_time, trace->burst_time, trace->priority };
+    TraceFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.header_size = sizeof(header);
+    header.count = (uint64_t)trace->count;
+
+    // Columns follow the header, each starting on an aligned offset
+    uint64_t offset = sizeof(header);
+    for (int c = 0; c < TRACE_NUM_COLUMNS; c++) {
+        offset = (offset + TRACE_COLUMN_ALIGNMENT - 1) / TRACE_COLUMN_ALIGNMENT * TRACE_COLUMN_ALIGNMENT;
+        header.column_offset[c] = offset;
+        offset += (uint64_t)trace->count * sizeof(int32_t);
+
+        int32_t min = 0, max = 0;
+        for (int i = 0; i < trace->count; i++) {
+            if (i == 0 || columns[c][i] < min) min = columns[c][i];
+            if (i == 0 || columns[c][i] > max) max = columns[c][i];
+        }
+        header.min_value[c] = min;
+        header.max_value[c] = max;
+    }
+
+    FILE *file = fopen(filename, "wb");
+    if (file == NULL) {
+        printf("Error: Could not create file '%s'\n", filename);
+        return false;
+    }
+
+    // Header fields are stored little-endian as well
+    TraceFileHeader stored = header;
+    if (!host_is_little_endian()) {
+        stored.version = swap32(stored.version);
+        stored.header_size = swap32(stored.header_size);
+        stored.count = swap64(stored.count);
+        for (int c = 0; c < TRACE_NUM_COLUMNS; c++) {
+            stored.column_offset[c] = swap64(stored.column_offset[c]);
+            stored.min_value[c] = (int32_t)swap32((uint32_t)stored.min_value[c]);
+            stored.max_value[c] = (int32_t)swap32((uint32_t)stored.max_value[c]);
+        }
+    }
+
+    bool ok = fwrite(&stored, sizeof(stored), 1, file) == 1;
+    uint64_t written = sizeof(header);
+    static const char padding[TRACE_COLUMN_ALIGNMENT] = {0};
+    for (int c = 0; c < TRACE_NUM_COLUMNS && ok; c++) {
+        ok = fwrite(padding, 1, header.column_offset[c] - written, file) == header.column_offset[c] - written;
+        ok = ok && write_column(file, columns[c], trace->count);
+        written = header.column_offset[c] + (uint64_t)trace->count * sizeof(int32_t);
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) {
+        printf("Error: Could not write file '%s'\n", filename);
+    }
+    if (header_out != NULL) {
+        *header_out = header;
+    }
+    return ok;
+}
+
+/**
+ * Release the file mapping behind a binary trace (arena columns are freed with the arena)
+ */
+void trace_close(Trace *trace) {
+    if (trace->mapping != NULL) {
+        munmap(trace->mapping, trace->mapping_size);
+        trace->mapping = NULL;
+        trace->mapping_size = 0;
+    }
+}
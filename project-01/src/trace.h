@@ -0,0 +1,47 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "arena.h"
+
+// Files larger than this are parsed on several threads
+#define TRACE_PARALLEL_MIN_BYTES (8 << 20)
+#define TRACE_MAX_THREADS 16
+
+// Binary trace format: header followed by one little-endian int32 array per column
+#define TRACE_MAGIC "SCHDTRC\0"
+#define TRACE_VERSION 1
+#define TRACE_NUM_COLUMNS 4
+#define TRACE_COLUMN_ALIGNMENT 64
+
+// Binary trace header (all fields little-endian)
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t count;
+    uint64_t column_offset[TRACE_NUM_COLUMNS];
+    int32_t min_value[TRACE_NUM_COLUMNS];
+    int32_t max_value[TRACE_NUM_COLUMNS];
+} TraceFileHeader;
+
+// Process trace stored column by column (PID Arrival_Time Burst_Time Priority)
+typedef struct {
+    int *id;
+    int *arrival_time;
+    int *burst_time;
+    int *priority;
+    int count;
+
+    // Set when the columns point straight into a mapped binary trace
+    void *mapping;
+    size_t mapping_size;
+} Trace;
+
+// Trace loading functions
+int trace_load(const char *filename, Arena *arena, Trace *trace, int num_threads);
+bool trace_write_binary(const char *filename, const Trace *trace, TraceFileHeader *header_out);
+void trace_close(Trace *trace);
+
+#endif // TRACE_H
@@ -0,0 +1,55 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Trace converter
+
+ * Converts a text trace (processes.txt format) into the binary columnar format so
+ * that large traces replayed many times are mapped instead of parsed on every run.
+
+ * Usage: ./trace_convert input.txt output.trace
+ * Output: binary trace file and a summary of the column statistics
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "trace.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        printf("Usage: %s input.txt output.trace\n", argv[0]);
+        return 1;
+    }
+
+    Arena arena;
+    Trace trace;
+    arena_init(&arena);
+
+    int n = trace_load(argv[1], &arena, &trace, 0);
+    if (n == 0) {
+        printf("Error: No processes read from '%s'\n", argv[1]);
+        trace_close(&trace);
+        arena_free(&arena);
+        return 1;
+    }
+
+    TraceFileHeader header;
+    bool ok = trace_write_binary(argv[2], &trace, &header);
+    if (ok) {
+        const char *names[TRACE_NUM_COLUMNS] = { "PID", "Arrival_Time", "Burst_Time", "Priority" };
+
+        printf("Converted %d processes from '%s' to '%s'\n\n", n, argv[1], argv[2]);
+        printf("Column\t\tMin\tMax\n");
+        for (int c = 0; c < TRACE_NUM_COLUMNS; c++) {
+            printf("%-12s\t%d\t%d\n", names[c], header.min_value[c], header.max_value[c]);
+        }
+    }
+
+    trace_close(&trace);
+    arena_free(&arena);
+    return ok ? 0 : 1;
+}
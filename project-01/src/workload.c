@@ -0,0 +1,287 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Synthetic workload generator
+
+ * Produces processes one at a time from a seeded splitmix64 stream, so a spec and
+ * seed always give the same trace on every platform and a trace of any length can be
+ * streamed to a file in constant memory. Arrivals are Poisson (exponential gaps) or
+ * bursty (Poisson-spaced clusters of geometric size arriving together); bursts are
+ * exponential, Pareto (heavy tail with the same mean) or bimodal.
+
+ * Input: WorkloadSpec
+ * Output: processes in arrival order with PIDs 1..count
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "workload.h"
+#include "memory_manager.h"
+
+/**
+ * Default workload: Poisson arrivals at 90% load with exponential bursts
+ */
+void workload_default_spec(WorkloadSpec *spec) {
+    spec->count = 1000;
+    spec->arrivals = ARRIVAL_POISSON;
+    spec->load = 0.9;
+    spec->mean_burst = 5.0;
+    spec->cluster_size = 8.0;
+    spec->bursts = BURST_EXPONENTIAL;
+    spec->pareto_shape = 1.5;
+    spec->bimodal_short = 2;
+    spec->bimodal_long = 30;
+    spec->bimodal_long_fraction = 0.1;
+    spec->max_priority = 10;
+    spec->min_memory = 64;
+    spec->max_memory = 512;
+    spec->seed = 42;
+}
+
+/**
+ * Check that a spec describes a valid workload
+ */
+bool workload_check_spec(const WorkloadSpec *spec) {
+    if (spec->count <= 0 || spec->count > INT_MAX) {
+        printf("Error: Process count must be between 1 and %d\n", INT_MAX);
+        return false;
+    }
+    if (!(spec->load > 0) || !(spec->mean_burst >= 1) || !(spec->cluster_size >= 1)) {
+        printf("Error: Load must be positive, mean burst and cluster size at least 1\n");
+        return false;
+    }
+    if (spec->bursts == BURST_PARETO && !(spec->pareto_shape > 1)) {
+        printf("Error: Pareto shape must be greater than 1\n");
+        return false;
+    }
+    if (spec->bimodal_short < 1 || spec->bimodal_long < spec->bimodal_short ||
+        spec->bimodal_long_fraction < 0 || spec->bimodal_long_fraction > 1) {
+        printf("Error: Invalid bimodal burst lengths\n");
+        return false;
+    }
+    if (spec->max_priority < 1 || spec->min_memory < 1 || spec->max_memory < spec->min_memory) {
+        printf("Error: Invalid priority or memory size range\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Apply one of the WORKLOAD_OPTIONS
+ * Returns false if the option or its value is not recognized.
+ */
+bool workload_parse_option(WorkloadSpec *spec, int option, const char *value) {
+    char *end;
+
+    switch (option) {
+        case 'a':
+            if (strcmp(value, "poisson") == 0) {
+                spec->arrivals = ARRIVAL_POISSON;
+            } else if (strcmp(value, "bursty") == 0) {
+                spec->arrivals = ARRIVAL_BURSTY;
+            } else {
+                return false;
+            }
+            return true;
+        case 'b':
+            if (strcmp(value, "exponential") == 0) {
+                spec->bursts = BURST_EXPONENTIAL;
+            } else if (strcmp(value, "pareto") == 0) {
+                spec->bursts = BURST_PARETO;
+            } else if (strcmp(value, "bimodal") == 0) {
+                spec->bursts = BURST_BIMODAL;
+            } else {
+                return false;
+            }
+            return true;
+        case 'l':
+            spec->load = strtod(value, &end);
+            return *end == '\0';
+        case 'c':
+            spec->cluster_size = strtod(value, &end);
+            return *end == '\0';
+        case 'm':
+            spec->mean_burst = strtod(value, &end);
+            return *end == '\0';
+        case 'r':
+            spec->seed = strtoull(value, &end, 10);
+            return *end == '\0';
+        default:
+            return false;
+    }
+}
+
+/**
+ * Expected CPU burst length of a spec (before rounding)
+ */
+double workload_mean_burst(const WorkloadSpec *spec) {
+    if (spec->bursts == BURST_BIMODAL) {
+        return spec->bimodal_short + spec->bimodal_long_fraction * (spec->bimodal_long - spec->bimodal_short);
+    }
+    return spec->mean_burst;
+}
+
+/**
+ * Next value of the splitmix64 stream
+ */
+static uint64_t next_random(WorkloadGenerator *generator) {
+    uint64_t z = (generator->state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Uniform double in (0, 1]
+ */
+static double next_unit(WorkloadGenerator *generator) {
+    return 1.0 - (double)(next_random(generator) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * Uniform integer in [low, high]
+ */
+static int next_int(WorkloadGenerator *generator, int low, int high) {
+    return low + (int)(next_random(generator) % (uint64_t)(high - low + 1));
+}
+
+/**
+ * Exponentially distributed value with the given mean
+ */
+static double next_exponential(WorkloadGenerator *generator, double mean) {
+    return -mean * log(next_unit(generator));
+}
+
+/**
+ * CPU burst length, at least 1
+ */
+static int next_burst(WorkloadGenerator *generator) {
+    const WorkloadSpec *spec = &generator->spec;
+    double burst;
+
+    switch (spec->bursts) {
+        case BURST_PARETO: {
+            // Scale chosen so the mean is mean_burst
+            double scale = spec->mean_burst * (spec->pareto_shape - 1) / spec->pareto_shape;
+            burst = scale / pow(next_unit(generator), 1.0 / spec->pareto_shape);
+            break;
+        }
+        case BURST_BIMODAL:
+            burst = (next_unit(generator) <= spec->bimodal_long_fraction) ? spec->bimodal_long : spec->bimodal_short;
+            break;
+        default:
+            burst = next_exponential(generator, spec->mean_burst);
+            break;
+    }
+
+    if (burst > WORKLOAD_MAX_BURST) return WORKLOAD_MAX_BURST;
+    return (burst < 1.5) ? 1 : (int)(burst + 0.5);
+}
+
+/**
+ * Start a generator at the first process of a workload
+ */
+void workload_init(WorkloadGenerator *generator, const WorkloadSpec *spec) {
+    generator->spec = *spec;
+    generator->state = spec->seed;
+    generator->arrival_rate = spec->load / workload_mean_burst(spec);
+    generator->clock = 0.0;
+    generator->generated = 0;
+    generator->cluster_left = 0;
+}
+
+/**
+ * Produce the next process
+ * Returns false once the workload is complete.
+ */
+bool workload_next(WorkloadGenerator *generator, WorkloadProcess *process) {
+    const WorkloadSpec *spec = &generator->spec;
+    if (generator->generated >= spec->count) return false;
+
+    if (spec->arrivals == ARRIVAL_BURSTY) {
+        // A new cluster starts after an exponential gap; its size is geometric
+        if (generator->cluster_left == 0) {
+            if (generator->generated > 0) {
+                generator->clock += next_exponential(generator, spec->cluster_size / generator->arrival_rate);
+            }
+            generator->cluster_left = 1;
+            while (next_unit(generator) > 1.0 / spec->cluster_size) {
+                generator->cluster_left++;
+            }
+        }
+        generator->cluster_left--;
+    } else if (generator->generated > 0) {
+        generator->clock += next_exponential(generator, 1.0 / generator->arrival_rate);
+    }
+
+    generator->generated++;
+    process->id = (int)generator->generated;
+    process->arrival_time = (generator->clock < INT_MAX) ? (int)generator->clock : INT_MAX;
+    process->burst_time = next_burst(generator);
+    process->priority = next_int(generator, 1, spec->max_priority);
+    process->memory_size = next_int(generator, spec->min_memory, spec->max_memory);
+    return true;
+}
+
+/**
+ * Generate a workload straight into a process table (memory sizes included)
+ */
+void workload_fill_table(const WorkloadSpec *spec, Arena *arena, ProcessTable *table) {
+    WorkloadGenerator generator;
+    WorkloadProcess process;
+
+    process_table_init(table, arena, (int)spec->count);
+    workload_init(&generator, spec);
+    for (int i = 0; workload_next(&generator, &process); i++) {
+        table->id[i] = process.id;
+        table->arrival_time[i] = process.arrival_time;
+        table->burst_time[i] = process.burst_time;
+        table->priority[i] = process.priority;
+        table->memory_size[i] = process.memory_size;
+    }
+    process_table_set_page_size(table, PAGE_SIZE);
+    process_table_reset(table);
+}
+
+/**
+ * Generate a workload into trace columns (for writing a binary trace)
+ */
+void workload_fill_trace(const WorkloadSpec *spec, Arena *arena, Trace *trace) {
+    WorkloadGenerator generator;
+    WorkloadProcess process;
+    size_t column = (size_t)spec->count * sizeof(int);
+
+    memset(trace, 0, sizeof(*trace));
+    trace->id = (int *)arena_alloc(arena, column);
+    trace->arrival_time = (int *)arena_alloc(arena, column);
+    trace->burst_time = (int *)arena_alloc(arena, column);
+    trace->priority = (int *)arena_alloc(arena, column);
+
+    workload_init(&generator, spec);
+    for (int i = 0; workload_next(&generator, &process); i++) {
+        trace->id[i] = process.id;
+        trace->arrival_time[i] = process.arrival_time;
+        trace->burst_time[i] = process.burst_time;
+        trace->priority[i] = process.priority;
+    }
+    trace->count = (int)spec->count;
+}
+
+/**
+ * Stream a workload as a text trace (processes.txt format) in constant memory
+ */
+bool workload_write_text(const WorkloadSpec *spec, FILE *out) {
+    WorkloadGenerator generator;
+    WorkloadProcess process;
+
+    fprintf(out, "PID  Arrival_Time  Burst_Time  Priority\n");
+    workload_init(&generator, spec);
+    while (workload_next(&generator, &process)) {
+        fprintf(out, "%d %d %d %d\n", process.id, process.arrival_time, process.burst_time, process.priority);
+    }
+    return !ferror(out);
+}
@@ -0,0 +1,81 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "arena.h"
+#include "trace.h"
+#include "process.h"
+
+// Longest burst a heavy-tailed distribution may produce
+#define WORKLOAD_MAX_BURST 1000000
+
+// Command-line options shared by the generator and the benchmarks
+#define WORKLOAD_OPTIONS "a:b:l:c:m:r:"
+#define WORKLOAD_USAGE "[-a poisson|bursty] [-b exponential|pareto|bimodal] [-l load] [-c cluster_size] " \
+                       "[-m mean_burst] [-r seed]"
+
+// How arrival times are spaced
+typedef enum {
+    ARRIVAL_POISSON, // Exponential gaps between single arrivals
+    ARRIVAL_BURSTY   // Poisson-spaced clusters of simultaneous arrivals
+} ArrivalPattern;
+
+// How CPU burst lengths are drawn
+typedef enum {
+    BURST_EXPONENTIAL,
+    BURST_PARETO,
+    BURST_BIMODAL
+} BurstDistribution;
+
+// Synthetic workload description; the same spec and seed give the same trace
+typedef struct {
+    long long count;
+    ArrivalPattern arrivals;
+    double load;                // Offered load: arrival rate x mean burst (1.0 keeps one CPU busy)
+    double cluster_size;        // Bursty: mean processes per cluster
+    BurstDistribution bursts;
+    double mean_burst;          // Exponential and Pareto mean
+    double pareto_shape;        // Pareto tail index (> 1)
+    int bimodal_short;
+    int bimodal_long;
+    double bimodal_long_fraction;
+    int max_priority;           // Priorities are uniform in 1..max_priority
+    int min_memory;             // Memory sizes are uniform in min..max (tables only,
+    int max_memory;             // trace files derive them from the PID)
+    uint64_t seed;
+} WorkloadSpec;
+
+// Generator state: one process is produced at a time
+typedef struct {
+    WorkloadSpec spec;
+    uint64_t state;
+    double arrival_rate;
+    double clock;
+    long long generated;
+    long long cluster_left;
+} WorkloadGenerator;
+
+// One generated process
+typedef struct {
+    int id;
+    int arrival_time;
+    int burst_time;
+    int priority;
+    int memory_size;
+} WorkloadProcess;
+
+// Workload functions
+void workload_default_spec(WorkloadSpec *spec);
+bool workload_check_spec(const WorkloadSpec *spec);
+double workload_mean_burst(const WorkloadSpec *spec);
+bool workload_parse_option(WorkloadSpec *spec, int option, const char *value);
+void workload_init(WorkloadGenerator *generator, const WorkloadSpec *spec);
+bool workload_next(WorkloadGenerator *generator, WorkloadProcess *process);
+void workload_fill_table(const WorkloadSpec *spec, Arena *arena, ProcessTable *table);
+void workload_fill_trace(const WorkloadSpec *spec, Arena *arena, Trace *trace);
+bool workload_write_text(const WorkloadSpec *spec, FILE *out);
+
+#endif // WORKLOAD_H
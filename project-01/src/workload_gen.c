@@ -0,0 +1,79 @@
+/**
+ * Author: Deepak Govindarajan
+ * CSC 4320 Operating Systems
+ * Project 1: Process Scheduling Simulation
+
+ * Synthetic trace generator
+
+ * Writes a seeded synthetic workload as a text trace (streamed, any length) or, when
+ * the output name ends in .trace, as a binary trace for repeated large runs.
+
+ * Usage: ./workload_gen [-n count] [-a poisson|bursty] [-b exponential|pareto|bimodal]
+ *                       [-l load] [-c cluster_size] [-m mean_burst] [-r seed] output
+ * Output: trace file ("-" writes the text trace to standard output)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "workload.h"
+
+/**
+ * Main function
+ */
+int main(int argc, char *argv[]) {
+    WorkloadSpec spec;
+    int option;
+
+    workload_default_spec(&spec);
+    while ((option = getopt(argc, argv, "n:" WORKLOAD_OPTIONS)) != -1) {
+        bool ok;
+        if (option == 'n') {
+            char *end;
+            spec.count = (long long)strtod(optarg, &end); // Accepts 1e6 as well as 1000000
+            ok = *end == '\0';
+        } else {
+            ok = workload_parse_option(&spec, option, optarg);
+        }
+        if (!ok) {
+            optind = argc;
+            break;
+        }
+    }
+    if (optind != argc - 1) {
+        printf("Usage: %s [-n count] " WORKLOAD_USAGE " output\n", argv[0]);
+        return 1;
+    }
+    if (!workload_check_spec(&spec)) return 1;
+
+    const char *filename = argv[optind];
+    size_t length = strlen(filename);
+    bool ok;
+
+    if (length > 6 && strcmp(filename + length - 6, ".trace") == 0) {
+        // Binary traces are written column by column, so the columns are built first
+        Arena arena;
+        Trace trace;
+        arena_init(&arena);
+        workload_fill_trace(&spec, &arena, &trace);
+        ok = trace_write_binary(filename, &trace, NULL);
+        arena_free(&arena);
+    } else if (strcmp(filename, "-") == 0) {
+        ok = workload_write_text(&spec, stdout);
+    } else {
+        FILE *file = fopen(filename, "w");
+        if (file == NULL) {
+            printf("Error: Could not create file '%s'\n", filename);
+            return 1;
+        }
+        ok = workload_write_text(&spec, file);
+        if (fclose(file) != 0) ok = false;
+        if (!ok) printf("Error: Could not write file '%s'\n", filename);
+    }
+
+    if (ok && strcmp(filename, "-") != 0) {
+        printf("Wrote %lld processes to '%s' (mean burst %.2f, load %.2f, seed %llu)\n", spec.count, filename,
+               workload_mean_burst(&spec), spec.load, (unsigned long long)spec.seed);
+    }
+    return ok ? 0 : 1;
+}